@@ -0,0 +1,359 @@
+/* vkfw_bench: measures the VKFW entry points on the NULL platform against the same work done with GLFW directly, so that the overhead of the wrapper
+   can be tracked between versions. prints one JSON object with nanoseconds per operation for both, to be compared by whatever runs it.
+   build it next to vkfw.c, for example: cc -std=c11 -O2 -I. bench/vkfw_bench.c vkfw.c -lglfw -lm -o vkfw_bench
+   usage: vkfw_bench [iteration count multiplier] */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* for clock_gettime */
+#endif
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "vkfw.h"
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* a monotonic clock rather than the GLFW or VKFW timers, which are not available while neither library is initialized */
+static double benchGetSeconds(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec * 1e-9;
+#endif
+}
+
+typedef struct BenchResult {
+    const char*     name;
+    uint32_t        iterationCount;
+    double          vkfwNanoseconds; /* per iteration */
+    double          glfwNanoseconds; /* per iteration, doing the same work with GLFW directly */
+} BenchResult;
+
+static uint32_t iterationMultiplier = 1;
+static BenchResult results[16];
+static uint32_t resultCount = 0;
+static VkfwBool32 benchFailed = VKFW_FALSE;
+
+#define BENCH_CHECK(expression) do { if(!(expression)) { fprintf(stderr, "vkfw_bench: %s failed at line %d\n", #expression, __LINE__); benchFailed = VKFW_TRUE; } } while(0)
+
+static void benchRecord(const char* name, uint32_t iterationCount, double vkfwStart, double vkfwEnd, double glfwStart, double glfwEnd) {
+    results[resultCount].name = name;
+    results[resultCount].iterationCount = iterationCount;
+    results[resultCount].vkfwNanoseconds = (vkfwEnd - vkfwStart) * 1e9 / iterationCount;
+    results[resultCount].glfwNanoseconds = (glfwEnd - glfwStart) * 1e9 / iterationCount;
+    resultCount++;
+}
+
+static VkfwInstance benchCreateInstance(void) {
+    VkfwInstanceCreateInfo createInfo;
+    VkfwInstance instance = NULL;
+    memset(&createInfo, 0, sizeof(createInfo));
+    createInfo.sType = VKFW_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    createInfo.desiredPlatform = VKFW_INSTANCE_PLATFORM_NULL;
+    BENCH_CHECK(vkfwCreateInstance(&createInfo, NULL, &instance) == VKFW_SUCCESS);
+    return instance;
+}
+static int benchInitGLFW(void) {
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    int initialized = glfwInit();
+    BENCH_CHECK(initialized);
+    return initialized;
+}
+static VkfwWindowCreateInfo benchGetWindowCreateInfo(void) {
+    VkfwWindowCreateInfo createInfo;
+    memset(&createInfo, 0, sizeof(createInfo));
+    createInfo.sType = VKFW_STRUCTURE_TYPE_WINDOW_CREATE_INFO;
+    createInfo.initialState.visible = VKFW_TRUE;
+    createInfo.initialState.decorated = VKFW_TRUE;
+    createInfo.initialState.resizable = VKFW_TRUE;
+    createInfo.initialState.cursorMode = VKFW_CURSOR_MODE_NORMAL;
+    createInfo.initialState.title = "vkfw_bench";
+    createInfo.initialState.size.width = 640;
+    createInfo.initialState.size.height = 480;
+    createInfo.initialState.opacity = 1.0f;
+    createInfo.requestedVideoMode.width = 640;
+    createInfo.requestedVideoMode.height = 480;
+    return createInfo;
+}
+static GLFWwindow* benchCreateGLFWWindow(void) {
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    return glfwCreateWindow(640, 480, "vkfw_bench", NULL, NULL);
+}
+
+static void benchInstanceLifetime(void) {
+    uint32_t iterationCount = 100 * iterationMultiplier, i;
+    
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        VkfwInstance instance = benchCreateInstance();
+        if(instance != NULL) vkfwDestroyInstance(instance, NULL);
+    }
+    double vkfwEnd = benchGetSeconds();
+    
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        if(benchInitGLFW()) glfwTerminate();
+    }
+    double glfwEnd = benchGetSeconds();
+    
+    benchRecord("instanceCreateDestroy", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+static void benchWindowLifetime(VkfwMonitor monitor) {
+    uint32_t iterationCount = 1000 * iterationMultiplier, i;
+    VkfwWindowCreateInfo createInfo = benchGetWindowCreateInfo();
+    
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        VkfwWindow window = NULL;
+        BENCH_CHECK(vkfwCreateWindow(monitor, &createInfo, NULL, &window) == VKFW_SUCCESS);
+        if(window != NULL) vkfwDestroyWindow(window, NULL);
+    }
+    double vkfwEnd = benchGetSeconds();
+    
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        GLFWwindow* window = benchCreateGLFWWindow();
+        BENCH_CHECK(window != NULL);
+        if(window != NULL) glfwDestroyWindow(window);
+    }
+    double glfwEnd = benchGetSeconds();
+    
+    benchRecord("windowCreateDestroy", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+/* the same state vkfwEnumerateWindowProperties returns, queried with GLFW directly */
+static unsigned int benchQueryGLFWWindowState(GLFWwindow* glfwWindow) {
+    unsigned int sink = 0;
+    int x, y, width, height, left, top, right, bottom;
+    double cursorX, cursorY;
+    float xScale, yScale;
+    
+    sink += glfwGetWindowMonitor(glfwWindow) != NULL;
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_ICONIFIED);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_RESIZABLE);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_VISIBLE);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_DECORATED);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_AUTO_ICONIFY);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_FLOATING);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_MAXIMIZED);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_FOCUS_ON_SHOW);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_MOUSE_PASSTHROUGH);
+    sink += glfwWindowShouldClose(glfwWindow);
+    sink += glfwGetInputMode(glfwWindow, GLFW_STICKY_KEYS);
+    sink += glfwGetInputMode(glfwWindow, GLFW_STICKY_MOUSE_BUTTONS);
+    sink += glfwGetInputMode(glfwWindow, GLFW_LOCK_KEY_MODS);
+    sink += glfwGetInputMode(glfwWindow, GLFW_RAW_MOUSE_MOTION);
+    sink += glfwGetInputMode(glfwWindow, GLFW_CURSOR);
+    sink += glfwGetWindowTitle(glfwWindow) != NULL;
+    glfwGetWindowPos(glfwWindow, &x, &y);
+    glfwGetWindowSize(glfwWindow, &width, &height);
+    glfwGetCursorPos(glfwWindow, &cursorX, &cursorY);
+    sink += (int) glfwGetWindowOpacity(glfwWindow);
+    sink += glfwGetWindowUserPointer(glfwWindow) != NULL;
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_FOCUSED);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_TRANSPARENT_FRAMEBUFFER);
+    sink += glfwGetWindowAttrib(glfwWindow, GLFW_HOVERED);
+    glfwGetFramebufferSize(glfwWindow, &width, &height);
+    glfwGetWindowFrameSize(glfwWindow, &left, &top, &right, &bottom);
+    glfwGetWindowContentScale(glfwWindow, &xScale, &yScale);
+    sink += width;
+    return sink;
+}
+static void benchWindowProperties(VkfwWindow window, GLFWwindow* glfwWindow) {
+    uint32_t iterationCount = 100000 * iterationMultiplier, i;
+    VkfwWindowProperties properties;
+    volatile unsigned int sink = 0; /* keeps the queries from being optimized away */
+    uint32_t failureCount = 0;
+    
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        failureCount += vkfwEnumerateWindowProperties(window, &properties) != VKFW_SUCCESS;
+        sink += properties.state.size.width;
+    }
+    double vkfwEnd = benchGetSeconds();
+    BENCH_CHECK(failureCount == 0); /* otherwise the loop measured the error path */
+    
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        sink += benchQueryGLFWWindowState(glfwWindow);
+    }
+    double glfwEnd = benchGetSeconds();
+    BENCH_CHECK(glfwGetError(NULL) == GLFW_NO_ERROR);
+    
+    benchRecord("enumerateWindowProperties", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+/* moves the window back and forth, so that every call changes one piece of state. vkfwSetWindowState reads the current state to find what
+   changed, so the GLFW side does the same reads before the one setter that applies the change. */
+static void benchSetWindowState(VkfwWindow window, GLFWwindow* glfwWindow) {
+    uint32_t iterationCount = 100000 * iterationMultiplier, i;
+    VkfwWindowProperties properties;
+    volatile unsigned int sink = 0; /* keeps the queries from being optimized away */
+    uint32_t failureCount = 0;
+    
+    BENCH_CHECK(vkfwEnumerateWindowProperties(window, &properties) == VKFW_SUCCESS);
+    VkfwWindowState state = properties.state;
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        state.position.x = (int32_t) (i & 1);
+        failureCount += vkfwSetWindowState(window, state) != VKFW_SUCCESS;
+    }
+    double vkfwEnd = benchGetSeconds();
+    BENCH_CHECK(failureCount == 0);
+    
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        sink += benchQueryGLFWWindowState(glfwWindow);
+        glfwSetWindowPos(glfwWindow, (int) (i & 1), 0);
+    }
+    double glfwEnd = benchGetSeconds();
+    BENCH_CHECK(glfwGetError(NULL) == GLFW_NO_ERROR);
+    
+    benchRecord("setWindowState", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+static void benchEnumeration(VkfwInstance instance) {
+    uint32_t iterationCount = 100000 * iterationMultiplier, i, j;
+    VkfwMonitor monitors[16];
+    VkfwJoystick joysticks[16];
+    uint32_t count;
+    volatile unsigned int sink = 0; /* keeps the queries from being optimized away */
+    int glfwCount;
+    uint32_t failureCount = 0;
+    
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        count = 16;
+        failureCount += vkfwEnumerateMonitors(instance, &count, monitors) != VKFW_SUCCESS;
+        sink += count;
+    }
+    double vkfwEnd = benchGetSeconds();
+    BENCH_CHECK(failureCount == 0);
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        sink += glfwGetMonitors(&glfwCount) != NULL;
+        sink += glfwCount;
+    }
+    double glfwEnd = benchGetSeconds();
+    BENCH_CHECK(glfwGetError(NULL) == GLFW_NO_ERROR);
+    benchRecord("enumerateMonitors", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+    
+    vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        count = 16;
+        failureCount += vkfwEnumerateJoysticks(instance, &count, joysticks) != VKFW_SUCCESS;
+        sink += count;
+    }
+    vkfwEnd = benchGetSeconds();
+    BENCH_CHECK(failureCount == 0);
+    glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        for(j = GLFW_JOYSTICK_1; j <= GLFW_JOYSTICK_LAST; j++) sink += glfwJoystickPresent((int) j);
+    }
+    glfwEnd = benchGetSeconds();
+    BENCH_CHECK(glfwGetError(NULL) == GLFW_NO_ERROR);
+    benchRecord("enumerateJoysticks", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+static void benchCursorLifetime(VkfwInstance instance) {
+    uint32_t iterationCount = 10000 * iterationMultiplier, i;
+    VkfwCursorCreateInfo createInfo;
+    
+    memset(&createInfo, 0, sizeof(createInfo));
+    createInfo.sType = VKFW_STRUCTURE_TYPE_CURSOR_CREATE_INFO;
+    createInfo.shape = VKFW_CURSOR_SHAPE_STANDARD_IBEAM_CURSOR;
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        VkfwCursor cursor = NULL;
+        BENCH_CHECK(vkfwCreateCursor(instance, &createInfo, NULL, &cursor) == VKFW_SUCCESS);
+        if(cursor != NULL) vkfwDestroyCursor(cursor, NULL);
+    }
+    double vkfwEnd = benchGetSeconds();
+    
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        GLFWcursor* cursor = glfwCreateStandardCursor(GLFW_IBEAM_CURSOR);
+        BENCH_CHECK(cursor != NULL);
+        if(cursor != NULL) glfwDestroyCursor(cursor);
+    }
+    double glfwEnd = benchGetSeconds();
+    
+    benchRecord("cursorCreateDestroy", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+/* the NULL platform generates no input, so this measures the dispatch of posted empty events through the event processing */
+static void benchEventDispatch(VkfwInstance instance) {
+    uint32_t iterationCount = 100000 * iterationMultiplier, i;
+    uint32_t failureCount = 0;
+    
+    double vkfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        failureCount += vkfwPostEmptyEvent(instance) != VKFW_SUCCESS;
+        failureCount += vkfwProcessEvents(instance, 0.0, VKFW_FALSE) != VKFW_SUCCESS;
+    }
+    double vkfwEnd = benchGetSeconds();
+    BENCH_CHECK(failureCount == 0);
+    
+    double glfwStart = benchGetSeconds();
+    for(i = 0; i < iterationCount; i++) {
+        glfwPostEmptyEvent();
+        glfwPollEvents();
+    }
+    double glfwEnd = benchGetSeconds();
+    BENCH_CHECK(glfwGetError(NULL) == GLFW_NO_ERROR);
+    
+    benchRecord("eventDispatch", iterationCount, vkfwStart, vkfwEnd, glfwStart, glfwEnd);
+}
+
+int main(int argc, char** argv) {
+    VkfwMonitor monitor;
+    VkfwWindow window = NULL;
+    uint32_t monitorCount = 1, i;
+    
+    if(argc > 1) iterationMultiplier = (uint32_t) strtoul(argv[1], NULL, 10);
+    if(iterationMultiplier == 0) iterationMultiplier = 1;
+    
+    benchInstanceLifetime();
+    
+    /* a VKFW instance is a GLFW initialization, so the GLFW side of the other benchmarks runs in the same session, on objects created directly */
+    VkfwInstance instance = benchCreateInstance();
+    if(instance == NULL) return EXIT_FAILURE;
+    BENCH_CHECK(vkfwEnumerateMonitors(instance, &monitorCount, &monitor) >= VKFW_SUCCESS && monitorCount == 1);
+    VkfwWindowCreateInfo createInfo = benchGetWindowCreateInfo();
+    BENCH_CHECK(vkfwCreateWindow(monitor, &createInfo, NULL, &window) == VKFW_SUCCESS);
+    GLFWwindow* glfwWindow = benchCreateGLFWWindow();
+    BENCH_CHECK(glfwWindow != NULL);
+    
+    if(window != NULL && glfwWindow != NULL) {
+        benchWindowLifetime(monitor);
+        benchWindowProperties(window, glfwWindow);
+        benchSetWindowState(window, glfwWindow);
+        benchEnumeration(instance);
+        benchCursorLifetime(instance);
+        benchEventDispatch(instance);
+    }
+    
+    if(glfwWindow != NULL) glfwDestroyWindow(glfwWindow);
+    if(window != NULL) vkfwDestroyWindow(window, NULL);
+    vkfwDestroyInstance(instance, NULL);
+    
+    printf("{\n  \"platform\": \"null\",\n  \"iterationMultiplier\": %u,\n  \"benchmarks\": [\n", iterationMultiplier);
+    for(i = 0; i < resultCount; i++) {
+        printf("    {\"name\": \"%s\", \"iterations\": %u, \"vkfwNanosecondsPerOperation\": %.1f, \"glfwNanosecondsPerOperation\": %.1f, \"overheadRatio\": %.3f}%s\n",
+               results[i].name, results[i].iterationCount, results[i].vkfwNanoseconds, results[i].glfwNanoseconds,
+               results[i].glfwNanoseconds > 0.0 ? results[i].vkfwNanoseconds / results[i].glfwNanoseconds : 0.0, i + 1 < resultCount ? "," : "");
+    }
+    printf("  ],\n  \"failed\": %s\n}\n", benchFailed ? "true" : "false");
+    
+    return benchFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
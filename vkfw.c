@@ -1,7 +1,76 @@
 
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* for clock_nanosleep */
+#endif
+
+/* building with VKFW_EXPOSE_NATIVE_WIN32, VKFW_EXPOSE_NATIVE_WAYLAND or VKFW_EXPOSE_NATIVE_X11 lets vkfwLoadVulkanInstanceFunctions resolve the
+   surface functions of these platforms, so that surfaces are created without GLFW looking them up by name every time. it needs the native
+   headers of the platform, and Xlib, XCB and X11-xcb for X11. without them, or on other platforms, the loaded functions fall back to GLFW. */
+#if defined(VKFW_EXPOSE_NATIVE_WIN32)
+#define VK_USE_PLATFORM_WIN32_KHR
+#define GLFW_EXPOSE_NATIVE_WIN32
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_WAYLAND)
+#define VK_USE_PLATFORM_WAYLAND_KHR
+#define GLFW_EXPOSE_NATIVE_WAYLAND
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_X11)
+#define VK_USE_PLATFORM_XLIB_KHR
+#define VK_USE_PLATFORM_XCB_KHR
+#define GLFW_EXPOSE_NATIVE_X11
+#endif
+
 #define GLFW_INCLUDE_VULKAN /* necessary to get Vulkan functions of GLFW */
 #include <GLFW/glfw3.h>
+#if defined(VKFW_EXPOSE_NATIVE_WIN32) || defined(VKFW_EXPOSE_NATIVE_WAYLAND) || defined(VKFW_EXPOSE_NATIVE_X11)
+#include <GLFW/glfw3native.h>
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_X11)
+#include <X11/Xlib-xcb.h> /* for XGetXCBConnection, to create XCB surfaces on the display of GLFW */
+#endif
 #include <stdlib.h> /* for malloc and free for the window handle structs */
+#include <stdio.h> /* for writing the trace in vkfwFlushTrace */
+#include <stddef.h> /* for max_align_t for the allocation headers */
+#include <stdatomic.h> /* for the joystick sample rings, which are read from other threads */
+#include <string.h> /* for memcpy in the image resampler */
+#include <math.h> /* for floorf and ceilf in the image resampler */
+
+/* waits for a deadline end with an absolute sleep on the monotonic clock, since the timeouts of the platform waits are too coarse for frame pacing.
+   the same clock is read directly by vkfwGetTimestamp, through the vDSO, if it turns out to be the clock of the GLFW timer. */
+#if defined(__linux__)
+#include <time.h>
+#include <errno.h>
+#define VKFW_PRECISE_WAIT
+#define VKFW_MONOTONIC_TIMESTAMP
+#endif
+
+/* the CPU time stamp counter, for VKFW_TIMESTAMP_SOURCE_CPU_COUNTER */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#include <cpuid.h>
+#define VKFW_TIMESTAMP_COUNTER
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define VKFW_TIMESTAMP_COUNTER
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKFW_RESAMPLE_SSE2
+#endif
+
+/* the pause in the spin waits, which lets the other hardware thread of the core run and avoids the memory order flush when the wait ends */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define VKFW_SPIN_PAUSE() _mm_pause()
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__GNUC__) || defined(__clang__))
+#define VKFW_SPIN_PAUSE() __asm__ __volatile__("yield")
+#elif defined(_M_ARM64) || defined(_M_ARM)
+#include <intrin.h>
+#define VKFW_SPIN_PAUSE() __yield()
+#else
+#define VKFW_SPIN_PAUSE()
+#endif
 
 #include "vkfw.h"
 
@@ -12,15 +81,1871 @@ const VkfwAllocationCallbacks* initAllocator = NULL;
 
 GLFWallocator ourGLFWAllocator;
 
+uint64_t timerFrequency = 0;
+
+/* vkfwGetTimestamp reads these without any other validation than vfkwInstanceInitialized, they are only changed by vkfwCreateInstance, vkfwDestroyInstance and vkfwSetTimestampSource */
+VkfwTimestampSource timestampSource = VKFW_TIMESTAMP_SOURCE_TIMER;
+uint64_t timestampFrequency = 0;
+VkfwBool32 timestampFromMonotonicClock = VKFW_FALSE;
+
+/* the entry points, other than the instance lifecycle and the timestamp and statistics reads, are implemented by their Untimed functions.
+   the exported functions are generated from this list at the end of this file, and only add one branch while statistics are disabled.
+   the third column is the VKFW_ALLOCATION_SUBSYSTEM_ the allocations of GLFW during the entry point are attributed to. */
+#define VKFW_TIMED_ENTRY_POINTS(X) \
+    X(VkfwResult  , vkfwEnumerateGlobalProperties, INTERNAL  , (VkfwGlobalProperties* pProperties), (pProperties)) \
+    X(VkfwResult  , vkfwEnumerateInstanceProperties, INTERNAL  , (VkfwInstance instance, VkfwInstanceProperties* pProperties), (instance, pProperties)) \
+    X(VkfwResult  , vkfwGetKeyScancode, INTERNAL  , (VkfwInstance instance, VkfwKey key, int32_t* pScancode), (instance, key, pScancode)) \
+    X(VkfwResult  , vkfwGetKeyName, INTERNAL  , (VkfwInstance instance, VkfwKey key, int32_t scancode, const char** pKeyName), (instance, key, scancode, pKeyName)) \
+    X(VkfwResult  , vkfwGetKeyNames, INTERNAL  , (VkfwInstance instance, uint32_t keyCount, const VkfwKey* pKeys, const char** pKeyNames), (instance, keyCount, pKeys, pKeyNames)) \
+    X(VkfwResult  , vkfwPostEmptyEvent, INTERNAL  , (VkfwInstance instance), (instance)) \
+    X(VkfwResult  , vkfwProcessEvents, INTERNAL  , (VkfwInstance instance, double timeout, VkfwBool32 waitIndefinitely), (instance, timeout, waitIndefinitely)) \
+    X(VkfwResult  , vkfwWaitEventsUntil, INTERNAL  , (VkfwInstance instance, uint64_t deadline), (instance, deadline)) \
+    X(VkfwResult  , vkfwProcessEventsBudgeted, INTERNAL  , (VkfwInstance instance, uint64_t maxTicks, VkfwBool32* pEventsRemaining), (instance, maxTicks, pEventsRemaining)) \
+    X(VkfwResult  , vkfwResetScratch, INTERNAL  , (VkfwInstance instance), (instance)) \
+    X(VkfwResult  , vkfwGetClipboardString, CLIPBOARD , (VkfwInstance instance, const char** pClipboardString), (instance, pClipboardString)) \
+    X(VkfwResult  , vkfwSetClipboardString, CLIPBOARD , (VkfwInstance instance, const char* clipboardString), (instance, clipboardString)) \
+    X(VkfwResult  , vkfwGetTimerValue, INTERNAL  , (VkfwInstance instance, uint64_t* pTimerValue), (instance, pTimerValue)) \
+    X(VkfwResult  , vkfwSetTimestampSource, INTERNAL  , (VkfwInstance instance, VkfwTimestampSource source), (instance, source)) \
+    X(VkfwResult  , vkfwGetTimestampFrequency, INTERNAL  , (VkfwInstance instance, uint64_t* pFrequency), (instance, pFrequency)) \
+    X(VkfwResult  , vkfwResetFrameClock, INTERNAL  , (VkfwInstance instance, VkfwFrameClock* pFrameClock), (instance, pFrameClock)) \
+    X(VkfwResult  , vkfwTickFrameClock, INTERNAL  , (VkfwFrameClock* pFrameClock), (pFrameClock)) \
+    X(VkfwResult  , vkfwGetFrameClockPercentile, INTERNAL  , (const VkfwFrameClock* pFrameClock, float percentile, double* pDelta), (pFrameClock, percentile, pDelta)) \
+    X(VkfwResult  , vkfwEnumerateMonitors, MONITOR   , (VkfwInstance instance, uint32_t* pMonitorCount, VkfwMonitor* pMonitors), (instance, pMonitorCount, pMonitors)) \
+    X(VkfwResult  , vkfwEnumerateMonitorProperties, MONITOR   , (VkfwMonitor monitor, VkfwMonitorProperties* pProperties), (monitor, pProperties)) \
+    X(VkfwResult  , vkfwSetMonitorUserPointer, MONITOR   , (VkfwMonitor monitor, void* pUserPointer), (monitor, pUserPointer)) \
+    X(VkfwResult  , vkfwSetMonitorGammaRamp, MONITOR   , (VkfwMonitor monitor, const VkfwGammaRamp* pGammaRamp), (monitor, pGammaRamp)) \
+    X(VkfwResult  , vkfwGetGammeRampFromGammaValue, MONITOR   , (VkfwMonitor monitor, float gamma, VkfwGammaRamp* pGammaRamp), (monitor, gamma, pGammaRamp)) \
+    X(VkfwResult  , vkfwCreateWindow, WINDOW    , (VkfwMonitor monitor, const VkfwWindowCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwWindow* pWindow), (monitor, pCreateInfo, pAllocator, pWindow)) \
+    X(VkfwResult  , vkfwDestroyWindow, WINDOW    , (VkfwWindow window, const VkfwAllocationCallbacks* pAllocator), (window, pAllocator)) \
+    X(VkfwResult  , vkfwEnumerateWindowProperties, WINDOW    , (VkfwWindow window, VkfwWindowProperties* pProperties), (window, pProperties)) \
+    X(VkfwResult  , vkfwSetWindowState, WINDOW    , (VkfwWindow window, VkfwWindowState newState), (window, newState)) \
+    X(VkfwResult  , vkfwSetWindowIcon, WINDOW    , (VkfwWindow window, uint32_t imageCount, const VkfwImageData* images), (window, imageCount, images)) \
+    X(VkfwResult  , vkfwSetWindowIconFromImage, WINDOW    , (VkfwWindow window, const VkfwImageData* pSourceImage), (window, pSourceImage)) \
+    X(VkfwResult  , vkfwGetWindowFramebufferExtent, WINDOW    , (VkfwWindow window, VkfwExtent2D* pExtent, uint64_t* pGeneration), (window, pExtent, pGeneration)) \
+    X(VkfwResult  , vkfwGetWindowNextFrameDeadline, WINDOW    , (VkfwWindow window, uint64_t previousDeadline, uint64_t* pDeadline), (window, previousDeadline, pDeadline)) \
+    X(VkfwResult  , vkfwSwitchWindowMonitor, WINDOW    , (VkfwWindow window, VkfwMonitor monitor, VkfwVideoMode* requestedVideoMode), (window, monitor, requestedVideoMode)) \
+    X(VkfwResult  , vkfwFocusWindow, WINDOW    , (VkfwWindow window), (window)) \
+    X(VkfwResult  , vkfwRequestWindowAttention, WINDOW    , (VkfwWindow window), (window)) \
+    X(VkfwResult  , vkfwSetWindowAspectRatio, WINDOW    , (VkfwWindow window, int32_t numerator, int32_t denominator), (window, numerator, denominator)) \
+    X(VkfwResult  , vkfwSetWindowSizeLimits, WINDOW    , (VkfwWindow window, VkfwExtent2D minimum, VkfwExtent2D maximum), (window, minimum, maximum)) \
+    X(VkfwResult  , vkfwCreateCursor, CURSOR    , (VkfwInstance instance, const VkfwCursorCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwCursor* pCursor), (instance, pCreateInfo, pAllocator, pCursor)) \
+    X(VkfwResult  , vkfwDestroyCursor, CURSOR    , (VkfwCursor cursor, const VkfwAllocationCallbacks* pAllocator), (cursor, pAllocator)) \
+    X(VkfwResult  , vkfwSetWindowCursor, CURSOR    , (VkfwWindow window, VkfwCursor cursor), (window, cursor)) \
+    X(VkfwResult  , vkfwCreateActionMap, ACTION_MAP, (VkfwInstance instance, const VkfwActionMapCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwActionMap* pActionMap), (instance, pCreateInfo, pAllocator, pActionMap)) \
+    X(VkfwResult  , vkfwDestroyActionMap, ACTION_MAP, (VkfwActionMap actionMap, const VkfwAllocationCallbacks* pAllocator), (actionMap, pAllocator)) \
+    X(VkfwResult  , vkfwSetActionMapBindings, ACTION_MAP, (VkfwActionMap actionMap, uint32_t bindingCount, const VkfwActionBinding* pBindings), (actionMap, bindingCount, pBindings)) \
+    X(VkfwResult  , vkfwGetActionMapState, ACTION_MAP, (VkfwActionMap actionMap, uint64_t* pStateBits), (actionMap, pStateBits)) \
+    X(VkfwResult  , vkfwSetWindowActionMap, ACTION_MAP, (VkfwWindow window, VkfwActionMap actionMap), (window, actionMap)) \
+    X(VkfwResult  , vkfwSetWindowDisabledEventTypes, WINDOW    , (VkfwWindow window, VkfwEventTypeFlags disabledEventTypes), (window, disabledEventTypes)) \
+    X(VkfwResult  , vkfwUpdateGamepadMappings, JOYSTICK  , (VkfwInstance instance, uint32_t mappingCount, const VkfwGamepadMapping* mappings), (instance, mappingCount, mappings)) \
+    X(VkfwResult  , vkfwEnumerateJoysticks, JOYSTICK  , (VkfwInstance instance, uint32_t* pJoystickCount, VkfwJoystick* pJoysticks), (instance, pJoystickCount, pJoysticks)) \
+    X(VkfwResult  , vkfwEnumerateJoystickProperties, JOYSTICK  , (VkfwJoystick joystick, VkfwJoystickProperties* pProperties), (joystick, pProperties)) \
+    X(VkfwResult  , vkfwSetJoystickUserPointer, JOYSTICK  , (VkfwJoystick joystick, void* pUserPointer), (joystick, pUserPointer)) \
+    X(VkfwResult  , vkfwSetJoystickSamplingRate, JOYSTICK  , (VkfwInstance instance, uint32_t samplesPerSecond), (instance, samplesPerSecond)) \
+    X(VkfwResult  , vkfwSampleJoysticks, JOYSTICK  , (VkfwInstance instance), (instance)) \
+    X(VkfwResult  , vkfwReadJoystickSamples, JOYSTICK  , (VkfwJoystick joystick, uint32_t* pSampleCount, VkfwJoystickSample* pSamples), (joystick, pSampleCount, pSamples)) \
+    X(VkfwVkBool32, vkfwVkGetPhysicalDevicePresentationSupport, INTERNAL  , (VkfwVkInstance instance, VkfwVkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex), (instance, physicalDevice, queueFamilyIndex)) \
+    X(VkfwVkResult, vkfwVkCreateWindowSurface, WINDOW    , (VkfwVkInstance instance, VkfwWindow window, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurface), (instance, window, pAllocator, pSurface)) \
+    X(VkfwResult  , vkfwVkGetPhysicalDevicesPresentationSupport, INTERNAL  , (VkfwVkInstance instance, uint32_t physicalDeviceCount, const VkfwVkPhysicalDevice* pPhysicalDevices, const uint32_t* pQueueFamilyCounts, uint64_t* pSupportMasks), (instance, physicalDeviceCount, pPhysicalDevices, pQueueFamilyCounts, pSupportMasks)) \
+    X(VkfwResult  , vkfwLoadVulkanInstanceFunctions, INTERNAL  , (VkfwInstance instance, VkfwVkInstance vulkanInstance), (instance, vulkanInstance)) \
+    X(VkfwResult  , vkfwUnloadVulkanInstanceFunctions, INTERNAL  , (VkfwInstance instance, VkfwVkInstance vulkanInstance), (instance, vulkanInstance)) \
+    X(VkfwResult  , vkfwVkCreateWindowSurfaces, WINDOW    , (VkfwVkInstance instance, uint32_t windowCount, const VkfwWindow* pWindows, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurfaces, VkfwVkResult* pResults), (instance, windowCount, pWindows, pAllocator, pSurfaces, pResults))
+
+#define VKFW_ENTRY_POINT_INDEX(returnType, name, subsystem, parameters, arguments) VKFW_ENTRY_POINT_INDEX_##name,
+typedef enum VkfwEntryPointIndex {
+    VKFW_TIMED_ENTRY_POINTS(VKFW_ENTRY_POINT_INDEX)
+    VKFW_ENTRY_POINT_COUNT
+} VkfwEntryPointIndex;
+#define VKFW_ENTRY_POINT_NAME(returnType, name, subsystem, parameters, arguments) #name,
+const char* const entryPointNames[VKFW_ENTRY_POINT_COUNT] = { VKFW_TIMED_ENTRY_POINTS(VKFW_ENTRY_POINT_NAME) };
+
+#if defined(_MSC_VER)
+#define VKFW_THREAD_LOCAL __declspec(thread)
+#else
+#define VKFW_THREAD_LOCAL _Thread_local
+#endif
+
+VKFW_THREAD_LOCAL uint32_t currentEntryPoint = VKFW_ENTRY_POINT_COUNT; /* the entry point running on the thread, VKFW_ENTRY_POINT_COUNT outside entry points */
+
+/* with allocation tracking, every allocation of VKFW and of GLFW gets a header with its size and subsystem, so that it can be accounted when it is freed.
+   the allocations of GLFW are attributed to the subsystem of the entry point currently running on the thread. */
+typedef union VkfwAllocationHeader {
+    struct {
+        size_t      size;
+        uint32_t    subsystemIndex;
+    }               info;
+    max_align_t     alignment;
+} VkfwAllocationHeader;
+typedef struct VkfwAllocationSubsystemCounters {
+    atomic_uint_least64_t   allocationCount;
+    atomic_uint_least64_t   freeCount;
+    atomic_uint_least64_t   allocatedBytes;
+    atomic_uint_least64_t   liveBytes;
+    atomic_uint_least64_t   peakLiveBytes;
+    atomic_uint_least64_t   frameStartAllocationCount;
+    atomic_uint_least64_t   frameStartAllocatedBytes;
+    atomic_uint_least64_t   previousFrameAllocationCount;
+    atomic_uint_least64_t   previousFrameAllocatedBytes;
+} VkfwAllocationSubsystemCounters;
+
+VkfwBool32 allocationTrackingEnabled = VKFW_FALSE;
+GLFWallocator trackingGLFWAllocator;
+VkfwAllocationSubsystemCounters allocationCounters[VKFW_ALLOCATION_SUBSYSTEM_COUNT + 1]; /* the last one counts all subsystems together */
+atomic_uint_least64_t allocationFrameCount = 0;
+#define VKFW_ENTRY_POINT_ALLOCATION_SUBSYSTEM(returnType, name, subsystem, parameters, arguments) (uint8_t) (VKFW_ALLOCATION_SUBSYSTEM_##subsystem - VKFW_ALLOCATION_SUBSYSTEM_INTERNAL),
+const uint8_t entryPointAllocationSubsystems[VKFW_ENTRY_POINT_COUNT] = { VKFW_TIMED_ENTRY_POINTS(VKFW_ENTRY_POINT_ALLOCATION_SUBSYSTEM) }; /* the subsystem indices */
+
+static void vkfwInitAllocationTracking(void) {
+    memset(allocationCounters, 0, sizeof(allocationCounters));
+    atomic_store(&allocationFrameCount, 0);
+}
+static void vkfwCountAllocation(uint32_t subsystemIndex, size_t size) {
+    uint32_t i;
+    uint32_t indices[2] = { subsystemIndex, VKFW_ALLOCATION_SUBSYSTEM_COUNT };
+    
+    for(i = 0; i < 2; i++) {
+        VkfwAllocationSubsystemCounters* pCounters = &allocationCounters[indices[i]];
+        atomic_fetch_add_explicit(&pCounters[0].allocationCount, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&pCounters[0].allocatedBytes, size, memory_order_relaxed);
+        uint64_t liveBytes = atomic_fetch_add_explicit(&pCounters[0].liveBytes, size, memory_order_relaxed) + size;
+        uint64_t peakLiveBytes = atomic_load_explicit(&pCounters[0].peakLiveBytes, memory_order_relaxed);
+        while(liveBytes > peakLiveBytes && !atomic_compare_exchange_weak_explicit(&pCounters[0].peakLiveBytes, &peakLiveBytes, liveBytes, memory_order_relaxed, memory_order_relaxed)) {}
+    }
+}
+static void vkfwCountFree(uint32_t subsystemIndex, size_t size) {
+    uint32_t i;
+    uint32_t indices[2] = { subsystemIndex, VKFW_ALLOCATION_SUBSYSTEM_COUNT };
+    
+    for(i = 0; i < 2; i++) {
+        atomic_fetch_add_explicit(&allocationCounters[indices[i]].freeCount, 1, memory_order_relaxed);
+        atomic_fetch_sub_explicit(&allocationCounters[indices[i]].liveBytes, size, memory_order_relaxed);
+    }
+}
+/* called at the start of every event processing */
+static void vkfwBeginAllocationFrame(void) {
+    uint32_t i;
+    
+    for(i = 0; i <= VKFW_ALLOCATION_SUBSYSTEM_COUNT; i++) {
+        VkfwAllocationSubsystemCounters* pCounters = &allocationCounters[i];
+        uint64_t allocationCount = atomic_load_explicit(&pCounters[0].allocationCount, memory_order_relaxed);
+        uint64_t allocatedBytes = atomic_load_explicit(&pCounters[0].allocatedBytes, memory_order_relaxed);
+        atomic_store_explicit(&pCounters[0].previousFrameAllocationCount, allocationCount - atomic_load_explicit(&pCounters[0].frameStartAllocationCount, memory_order_relaxed), memory_order_relaxed);
+        atomic_store_explicit(&pCounters[0].previousFrameAllocatedBytes, allocatedBytes - atomic_load_explicit(&pCounters[0].frameStartAllocatedBytes, memory_order_relaxed), memory_order_relaxed);
+        atomic_store_explicit(&pCounters[0].frameStartAllocationCount, allocationCount, memory_order_relaxed);
+        atomic_store_explicit(&pCounters[0].frameStartAllocatedBytes, allocatedBytes, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit(&allocationFrameCount, 1, memory_order_relaxed);
+}
+/* the allocations of VKFW itself, through the allocator of the object they belong to, or that of the instance like the ones of GLFW if pAllocator is NULL */
+static void* vkfwAllocateWith(const VkfwAllocationCallbacks* pAllocator, size_t size, VkfwAllocationSubsystem subsystem) {
+    if(pAllocator == NULL) pAllocator = initAllocator;
+    if(!allocationTrackingEnabled) return (pAllocator != NULL) ? pAllocator[0].pfnAllocation(size, pAllocator[0].pUserData) : malloc(size);
+    
+    VkfwAllocationHeader* pHeader = (pAllocator != NULL) ? pAllocator[0].pfnAllocation(sizeof(VkfwAllocationHeader) + size, pAllocator[0].pUserData)
+                                                         : malloc(sizeof(VkfwAllocationHeader) + size);
+    if(pHeader == NULL) return NULL;
+    pHeader[0].info.size = size;
+    pHeader[0].info.subsystemIndex = subsystem - VKFW_ALLOCATION_SUBSYSTEM_INTERNAL;
+    vkfwCountAllocation(pHeader[0].info.subsystemIndex, size);
+    return &pHeader[1];
+}
+static void vkfwFreeWith(const VkfwAllocationCallbacks* pAllocator, void* pMemory) {
+    if(pMemory == NULL) return;
+    if(pAllocator == NULL) pAllocator = initAllocator;
+    if(!allocationTrackingEnabled) {
+        if(pAllocator != NULL) pAllocator[0].pfnFree(pMemory, pAllocator[0].pUserData);
+        else free(pMemory);
+        return;
+    }
+    
+    VkfwAllocationHeader* pHeader = &((VkfwAllocationHeader*) pMemory)[-1];
+    vkfwCountFree(pHeader[0].info.subsystemIndex, pHeader[0].info.size);
+    if(pAllocator != NULL) pAllocator[0].pfnFree(pHeader, pAllocator[0].pUserData);
+    else free(pHeader);
+}
+static void* vkfwAllocate(size_t size, VkfwAllocationSubsystem subsystem) {
+    return vkfwAllocateWith(NULL, size, subsystem);
+}
+static void vkfwFree(void* pMemory) {
+    vkfwFreeWith(NULL, pMemory);
+}
+/* windows and cursors keep a copy of the allocator they were created with, with pfnAllocation NULL for the one of the instance */
+static const VkfwAllocationCallbacks* vkfwGetObjectAllocator(const VkfwAllocationCallbacks* pObjectAllocator) {
+    return (pObjectAllocator[0].pfnAllocation != NULL) ? pObjectAllocator : NULL;
+}
+static VkfwResult vkfwInitObjectAllocator(const VkfwAllocationCallbacks* pAllocator, VkfwAllocationCallbacks* pObjectAllocator) {
+    memset(pObjectAllocator, 0, sizeof(VkfwAllocationCallbacks));
+    if(pAllocator == NULL || pAllocator == initAllocator) return VKFW_SUCCESS;
+    if(pAllocator[0].pfnAllocation == NULL || pAllocator[0].pfnFree == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE; /* VKFW doesn't reallocate object memory */
+    pObjectAllocator[0] = pAllocator[0];
+    return VKFW_SUCCESS;
+}
+/* like in Vulkan, an object has to be destroyed with an allocator compatible with the one it was created with */
+static VkfwBool32 vkfwIsObjectAllocatorCompatible(const VkfwAllocationCallbacks* pObjectAllocator, const VkfwAllocationCallbacks* pAllocator) {
+    if(vkfwGetObjectAllocator(pObjectAllocator) == NULL) return (pAllocator == NULL || pAllocator == initAllocator) ? VKFW_TRUE : VKFW_FALSE;
+    if(pAllocator == NULL) return VKFW_FALSE;
+    return (pAllocator[0].pfnAllocation == pObjectAllocator[0].pfnAllocation && pAllocator[0].pfnFree == pObjectAllocator[0].pfnFree
+                && pAllocator[0].pUserData == pObjectAllocator[0].pUserData) ? VKFW_TRUE : VKFW_FALSE;
+}
+/* the allocator given to GLFW with allocation tracking, GLFW handles NULL blocks and zero sizes itself */
+static void* vkfwAllocateForGLFW(size_t size, void* pUserData) {
+    (void) pUserData;
+    return vkfwAllocate(size, (VkfwAllocationSubsystem) (VKFW_ALLOCATION_SUBSYSTEM_INTERNAL
+                            + (currentEntryPoint < VKFW_ENTRY_POINT_COUNT ? entryPointAllocationSubsystems[currentEntryPoint] : 0)));
+}
+static void* vkfwReallocateForGLFW(void* pMemory, size_t size, void* pUserData) {
+    (void) pUserData;
+    VkfwAllocationHeader* pHeader = &((VkfwAllocationHeader*) pMemory)[-1];
+    uint32_t subsystemIndex = pHeader[0].info.subsystemIndex;
+    size_t previousSize = pHeader[0].info.size;
+    
+    pHeader = (initAllocator != NULL) ? initAllocator[0].pfnReallocation(pHeader, sizeof(VkfwAllocationHeader) + size, initAllocator[0].pUserData)
+                                      : realloc(pHeader, sizeof(VkfwAllocationHeader) + size);
+    if(pHeader == NULL) return NULL;
+    pHeader[0].info.size = size;
+    vkfwCountFree(subsystemIndex, previousSize);
+    vkfwCountAllocation(subsystemIndex, size);
+    return &pHeader[1];
+}
+static void vkfwFreeForGLFW(void* pMemory, void* pUserData) {
+    (void) pUserData;
+    vkfwFree(pMemory);
+}
+
+/* statistics and trace events are recorded by each thread into its own block, without contention, and read by vkfwGetInstanceStatistics and
+   vkfwFlushTrace. only the thread owning a block writes to it, the counters and ring indices are atomic so that they can be read meanwhile. */
+typedef struct VkfwEntryPointCounters {
+    atomic_uint_least64_t   callCount;
+    atomic_uint_least64_t   totalNanoseconds;
+    atomic_uint_least64_t   latencyHistogram[VKFW_LATENCY_HISTOGRAM_BUCKET_COUNT];
+} VkfwEntryPointCounters;
+
+#define VKFW_TRACE_RING_LENGTH 16384
+
+typedef enum VkfwTraceEventKind {
+    VKFW_TRACE_EVENT_API,
+    VKFW_TRACE_EVENT_CALLBACK
+} VkfwTraceEventKind;
+/* an event is recorded as a whole when its call or callback returns, so that a full ring can't keep one end of it without the other */
+typedef struct VkfwTraceEvent {
+    uint64_t                timestamp; /* of the start */
+    uint64_t                duration;
+    const char*             name; /* a string literal, so that it stays valid until the flush */
+    uint64_t                windowSerial; /* of the VkfwWindow the call or callback is about, 0 for none */
+    VkfwTraceEventKind      kind;
+} VkfwTraceEvent;
+/* events which don't fit are dropped, rather than overwriting events the flush may be reading */
+typedef struct VkfwTraceRing {
+    atomic_uint_least32_t   head;
+    atomic_uint_least32_t   tail;
+    atomic_uint_least64_t   droppedEventCount;
+    VkfwTraceEvent          events[VKFW_TRACE_RING_LENGTH];
+} VkfwTraceRing;
+
+typedef struct VkfwThreadInstrumentation {
+    struct VkfwThreadInstrumentation*   pNext;
+    uint32_t                            threadIndex; /* in the order the threads first called VKFW, for the trace */
+    VkfwTraceRing*                      pTraceRing; /* only while tracing */
+    VkfwEntryPointCounters              entryPoints[VKFW_ENTRY_POINT_COUNT];
+} VkfwThreadInstrumentation;
+
+/* the flags and the generation are read by the entry points on any thread, so they are atomic; relaxed loads are plain loads where it matters */
+_Atomic(VkfwBool32) statisticsEnabled = VKFW_FALSE;
+_Atomic(VkfwBool32) traceEnabled = VKFW_FALSE;
+_Atomic(VkfwBool32) instrumentationEnabled = VKFW_FALSE; /* either of them, only then the entry points read timestamps */
+_Atomic(VkfwBool32) entryPointTrackingEnabled = VKFW_FALSE; /* instrumentation or allocation tracking, for the one branch of the entry points */
+atomic_uint_least64_t instrumentationGeneration = 0; /* incremented per instance, so that threads notice that their block of a previous instance is gone */
+atomic_uint_least32_t instrumentedCallCount = 0; /* entry points recording right now, which vkfwDestroyInstance waits for before freeing the blocks */
+_Atomic(VkfwThreadInstrumentation*) threadInstrumentationList = NULL;
+atomic_uint_least32_t instrumentedThreadCount = 0;
+VKFW_THREAD_LOCAL VkfwThreadInstrumentation* pCurrentThreadInstrumentation = NULL;
+VKFW_THREAD_LOCAL uint64_t currentThreadInstrumentationGeneration = 0;
+
+/* the callbacks VKFW calls itself are traced with the window they are about, whose serial is taken first since the callback may destroy it */
+#define VKFW_TRACED_CALLBACK(name, window, statement) do {                         \
+    if(atomic_load_explicit(&traceEnabled, memory_order_relaxed)) {             \
+        uint64_t callbackWindowSerial = vkfwGetWindowSerial(window);            \
+        uint64_t callbackStartTimestamp = vkfwGetTimestamp();                   \
+        statement;                                                              \
+        vkfwRecordTraceEvent(VKFW_TRACE_EVENT_CALLBACK, name, callbackWindowSerial, callbackStartTimestamp); \
+    } else {                                                                    \
+        statement;                                                              \
+    }                                                                           \
+} while(0)
+static VkfwThreadInstrumentation* vkfwGetThreadInstrumentation(void) {
+    uint32_t i, j;
+    
+    uint64_t generation = atomic_load_explicit(&instrumentationGeneration, memory_order_relaxed);
+    if(currentThreadInstrumentationGeneration == generation) return pCurrentThreadInstrumentation;
+    
+    /* a thread which can't get a block doesn't record anything, rather than trying again on every call */
+    currentThreadInstrumentationGeneration = generation;
+    pCurrentThreadInstrumentation = vkfwAllocate(sizeof(VkfwThreadInstrumentation), VKFW_ALLOCATION_SUBSYSTEM_INTERNAL);
+    if(pCurrentThreadInstrumentation == NULL) return NULL;
+    for(i = 0; i < VKFW_ENTRY_POINT_COUNT; i++) {
+        atomic_init(&pCurrentThreadInstrumentation[0].entryPoints[i].callCount, 0);
+        atomic_init(&pCurrentThreadInstrumentation[0].entryPoints[i].totalNanoseconds, 0);
+        for(j = 0; j < VKFW_LATENCY_HISTOGRAM_BUCKET_COUNT; j++) atomic_init(&pCurrentThreadInstrumentation[0].entryPoints[i].latencyHistogram[j], 0);
+    }
+    pCurrentThreadInstrumentation[0].threadIndex = atomic_fetch_add(&instrumentedThreadCount, 1);
+    pCurrentThreadInstrumentation[0].pTraceRing = atomic_load_explicit(&traceEnabled, memory_order_relaxed) ? vkfwAllocate(sizeof(VkfwTraceRing), VKFW_ALLOCATION_SUBSYSTEM_INTERNAL) : NULL;
+    if(pCurrentThreadInstrumentation[0].pTraceRing != NULL) {
+        atomic_init(&pCurrentThreadInstrumentation[0].pTraceRing[0].head, 0);
+        atomic_init(&pCurrentThreadInstrumentation[0].pTraceRing[0].tail, 0);
+        atomic_init(&pCurrentThreadInstrumentation[0].pTraceRing[0].droppedEventCount, 0);
+    }
+    
+    pCurrentThreadInstrumentation[0].pNext = atomic_load(&threadInstrumentationList);
+    while(!atomic_compare_exchange_weak(&threadInstrumentationList, &pCurrentThreadInstrumentation[0].pNext, pCurrentThreadInstrumentation)) {}
+    
+    return pCurrentThreadInstrumentation;
+}
+/* only the owning thread writes a counter, so it needs no atomic read-modify-write */
+static void vkfwAddToCounter(atomic_uint_least64_t* pCounter, uint64_t value) {
+    atomic_store_explicit(pCounter, atomic_load_explicit(pCounter, memory_order_relaxed) + value, memory_order_relaxed);
+}
+static uint64_t vkfwGetElapsedNanoseconds(uint64_t startTimestamp) {
+    uint64_t elapsedTicks = vkfwGetTimestamp() - startTimestamp;
+    if(timestampFrequency == 1000000000) return elapsedTicks;
+    return (uint64_t) ((double) elapsedTicks * 1000000000.0 / (double) timestampFrequency);
+}
+static void vkfwRecordEntryPoint(uint32_t entryPoint, uint64_t startTimestamp) {
+    VkfwThreadInstrumentation* pInstrumentation = vkfwGetThreadInstrumentation();
+    if(pInstrumentation == NULL) return;
+    
+    uint64_t nanoseconds = vkfwGetElapsedNanoseconds(startTimestamp);
+    uint64_t bucketValue = nanoseconds;
+    uint32_t bucket = 0;
+    while(bucketValue > 1 && bucket < VKFW_LATENCY_HISTOGRAM_BUCKET_COUNT - 1) {
+        bucketValue >>= 1;
+        bucket++;
+    }
+    
+    VkfwEntryPointCounters* pCounters = &pInstrumentation[0].entryPoints[entryPoint];
+    vkfwAddToCounter(&pCounters[0].callCount, 1);
+    vkfwAddToCounter(&pCounters[0].totalNanoseconds, nanoseconds);
+    vkfwAddToCounter(&pCounters[0].latencyHistogram[bucket], 1);
+}
+static void vkfwRecordTraceEvent(VkfwTraceEventKind kind, const char* name, uint64_t windowSerial, uint64_t startTimestamp) {
+    VkfwThreadInstrumentation* pInstrumentation = vkfwGetThreadInstrumentation();
+    if(pInstrumentation == NULL || pInstrumentation[0].pTraceRing == NULL) return;
+    
+    VkfwTraceRing* pRing = pInstrumentation[0].pTraceRing;
+    uint32_t head = atomic_load_explicit(&pRing[0].head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&pRing[0].tail, memory_order_acquire);
+    if(head - tail >= VKFW_TRACE_RING_LENGTH) {
+        vkfwAddToCounter(&pRing[0].droppedEventCount, 1);
+        return;
+    }
+    
+    VkfwTraceEvent* pEvent = &pRing[0].events[head % VKFW_TRACE_RING_LENGTH];
+    pEvent[0].timestamp = startTimestamp;
+    pEvent[0].duration  = vkfwGetTimestamp() - startTimestamp;
+    pEvent[0].name      = name;
+    pEvent[0].windowSerial = windowSerial;
+    pEvent[0].kind      = kind;
+    atomic_store_explicit(&pRing[0].head, head + 1, memory_order_release);
+}
+/* entry points on other threads may still be recording, like render threads reading the framebuffer extent. after the flags are cleared no new
+   call starts recording, and the ones which started are waited for, so that no thread writes to a block after it is freed. */
+static void vkfwFreeInstrumentation(void) {
+    atomic_store(&statisticsEnabled, VKFW_FALSE);
+    atomic_store(&traceEnabled, VKFW_FALSE);
+    atomic_store(&instrumentationEnabled, VKFW_FALSE);
+    while(atomic_load(&instrumentedCallCount) != 0) VKFW_SPIN_PAUSE();
+    
+    VkfwThreadInstrumentation* pInstrumentation = atomic_exchange(&threadInstrumentationList, NULL);
+    while(pInstrumentation != NULL) {
+        VkfwThreadInstrumentation* pNext = pInstrumentation[0].pNext;
+        vkfwFree(pInstrumentation[0].pTraceRing);
+        vkfwFree(pInstrumentation);
+        pInstrumentation = pNext;
+    }
+    atomic_store(&instrumentedThreadCount, 0);
+}
+
+/* strings and arrays returned from GLFW buffers, which the next call or event processing may overwrite, are copied into a bump arena owned by the
+   instance. the copies stay valid until the next event processing or vkfwResetScratch, which only rewind the arena. once the arena outgrew its
+   first block, a reset keeps just the newest and largest block, so that steady use stops allocating. like GLFW, only for the main thread. */
+#define VKFW_SCRATCH_MIN_BLOCK_SIZE 4096
+
+typedef union VkfwScratchBlock {
+    struct {
+        union VkfwScratchBlock* pPrevious;
+        size_t                  size; /* of the memory after the block header */
+        size_t                  used;
+    }               info;
+    max_align_t     alignment;
+} VkfwScratchBlock;
+
+VkfwScratchBlock* pScratchBlock = NULL;
+
+static void* vkfwAllocateScratch(size_t size) {
+    size = (size + sizeof(max_align_t) - 1) / sizeof(max_align_t) * sizeof(max_align_t);
+    if(pScratchBlock == NULL || pScratchBlock[0].info.size - pScratchBlock[0].info.used < size) {
+        size_t blockSize = (pScratchBlock != NULL) ? pScratchBlock[0].info.size * 2 : VKFW_SCRATCH_MIN_BLOCK_SIZE;
+        while(blockSize < size) blockSize *= 2;
+        VkfwScratchBlock* pBlock = vkfwAllocate(sizeof(VkfwScratchBlock) + blockSize, VKFW_ALLOCATION_SUBSYSTEM_INTERNAL);
+        if(pBlock == NULL) return NULL;
+        pBlock[0].info.pPrevious = pScratchBlock;
+        pBlock[0].info.size = blockSize;
+        pBlock[0].info.used = 0;
+        pScratchBlock = pBlock;
+    }
+    
+    void* pMemory = (uint8_t*) &pScratchBlock[1] + pScratchBlock[0].info.used;
+    pScratchBlock[0].info.used += size;
+    return pMemory;
+}
+/* NULL stays NULL, since GLFW returns that for absent names */
+static VkfwResult vkfwCopyStringToScratch(const char* string, const char** pCopy) {
+    if(string == NULL) {
+        pCopy[0] = NULL;
+        return VKFW_SUCCESS;
+    }
+    size_t size = strlen(string) + 1;
+    char* copy = vkfwAllocateScratch(size);
+    if(copy == NULL) return VKFW_ERROR_OUT_OF_MEMORY;
+    memcpy(copy, string, size);
+    pCopy[0] = copy;
+    return VKFW_SUCCESS;
+}
+static void vkfwRewindScratch(void) {
+    if(pScratchBlock == NULL) return;
+    while(pScratchBlock[0].info.pPrevious != NULL) {
+        VkfwScratchBlock* pPrevious = pScratchBlock[0].info.pPrevious;
+        pScratchBlock[0].info.pPrevious = pPrevious[0].info.pPrevious;
+        vkfwFree(pPrevious);
+    }
+    pScratchBlock[0].info.used = 0;
+}
+static void vkfwFreeScratch(void) {
+    vkfwRewindScratch();
+    vkfwFree(pScratchBlock);
+    pScratchBlock = NULL;
+}
+
+/* key scancodes and names only change with the keyboard layout, but GLFW asks the platform keymap on every query. they are kept in dense tables,
+   built on the first query and rebuilt on the first one after a window gained focus, which is where a layout switch made in another
+   application or the system UI shows up; GLFW has no event for the layout change itself. like the queries themselves, only for the main thread. */
+#define VKFW_KEY_TABLE_SCANCODE_COUNT   512 /* covers the scancodes of all platforms GLFW supports */
+#define VKFW_KEY_NAME_MAX_SIZE          32 /* GLFW 3.4 names have at most 16 bytes */
+
+int32_t keyScancodes[VKFW_KEY_LAST + 1];
+char keyNames[VKFW_KEY_LAST + 1][VKFW_KEY_NAME_MAX_SIZE]; /* empty for keys without a name */
+char scancodeNames[VKFW_KEY_TABLE_SCANCODE_COUNT][VKFW_KEY_NAME_MAX_SIZE];
+VkfwBool32 scancodeValid[VKFW_KEY_TABLE_SCANCODE_COUNT]; /* scancodes the platform doesn't have are an error, like in GLFW */
+VkfwBool32 keyTablesValid = VKFW_FALSE;
+
+static void vkfwCopyKeyName(const char* name, char* pDestination) {
+    size_t length = (name != NULL) ? strlen(name) : 0;
+    if(length >= VKFW_KEY_NAME_MAX_SIZE) length = 0; /* can't happen with GLFW 3.4, but no name is better than a cut UTF-8 sequence */
+    if(length > 0) memcpy(pDestination, name, length);
+    pDestination[length] = '\0';
+}
+static void vkfwBuildKeyTables(void) {
+    int32_t key, scancode;
+    
+    for(key = 0; key <= VKFW_KEY_LAST; key++) {
+        keyScancodes[key] = -1;
+        keyNames[key][0] = '\0';
+        if(key < VKFW_KEY_SPACE) continue;
+        keyScancodes[key] = glfwGetKeyScancode(key);
+        vkfwCopyKeyName(glfwGetKeyName(key, 0), keyNames[key]);
+    }
+    glfwGetError(NULL);
+    for(scancode = 0; scancode < VKFW_KEY_TABLE_SCANCODE_COUNT; scancode++) {
+        vkfwCopyKeyName(glfwGetKeyName(GLFW_KEY_UNKNOWN, scancode), scancodeNames[scancode]);
+        scancodeValid[scancode] = (glfwGetError(NULL) == GLFW_NO_ERROR) ? VKFW_TRUE : VKFW_FALSE;
+    }
+    
+    keyTablesValid = VKFW_TRUE;
+}
+
+/* the joystick sample rings are written by the thread processing events and read by vkfwReadJoystickSamples, possibly on another thread.
+   the writer never waits for the reader: a full ring overwrites its oldest sample, so the writer announces the slot it is about to overwrite in
+   writing before touching it, and the reader drops the samples it copied that were claimed in the meantime, like a seqlock. the reader owns
+   tail; a new connection of the joystick moves first past the samples of the previous device, and the reader skips to it. the samples are
+   stored as relaxed atomic words, so that a copy racing with an overwrite is a dropped sample and not undefined behaviour. the rings are
+   static, so that a reader never sees them freed, and are only touched while sampling is enabled. */
+#define VKFW_JOYSTICK_SAMPLE_WORD_COUNT ((sizeof(VkfwJoystickSample) + sizeof(uint32_t) - 1) / sizeof(uint32_t))
+typedef struct VkfwJoystickSampleRing {
+    atomic_uint_least32_t   head; /* samples published */
+    atomic_uint_least32_t   writing; /* samples claimed by the writer, head or head + 1 */
+    atomic_uint_least32_t   first; /* the first sample of the current connection */
+    atomic_uint_least32_t   tail; /* the next sample to read */
+    VkfwBool32              connected; /* only for the writer: whether the previous sample had the joystick present */
+    atomic_uint_least32_t   sampleWords[VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH][VKFW_JOYSTICK_SAMPLE_WORD_COUNT];
+} VkfwJoystickSampleRing;
+
+VkfwInstanceCallbacks instanceCallbacks;
+
+VkfwJoystickSampleRing joystickSampleRings[GLFW_JOYSTICK_LAST + 1]; /* one per GLFW joystick ID */
+uint64_t joystickSamplingPeriod = 0; /* in timer ticks, 0 if sampling is disabled */
+uint64_t joystickNextSampleTime = 0;
+
+/* the last reported joystick state, to generate the joystick and gamepad input callbacks from. the axes only get updated when they are reported. */
+VkfwBool32 joystickEventsEnabled = VKFW_FALSE;
+VkfwBool32 joystickCallbacksEnabled = VKFW_FALSE; /* the events are also enabled while an action map has gamepad bindings */
+float joystickAxisChangeThreshold = 0.0f;
+VkfwJoystickSample joystickSnapshots[GLFW_JOYSTICK_LAST + 1];
+VkfwBool32 joystickSnapshotValid[GLFW_JOYSTICK_LAST + 1];
+
+#define VKFW_DEFAULT_TEXT_INPUT_BUFFER_SIZE 256
+
 /* we need this struct, instead of casting to GLFWwindow*, in order to keep the monitor handle we want to go to fullscreen mode in.
    the video mode is stored because the refreshRate is needed for glfwSetWindowMonitor and not retrievable by state retrieval functions. */
 typedef struct VkfwWindow_t {
-    GLFWwindow*     windowHandle;
-    GLFWmonitor*    monitorHandle;
-    VkfwVideoMode   usedVideoMode;
+    GLFWwindow*         windowHandle;
+    GLFWmonitor*        monitorHandle;
+    VkfwVideoMode       usedVideoMode;
+    void*               pUserPointer; /* the GLFW user pointer points to this struct, so that our callbacks can find it */
+    VkfwWindowCallbacks callbacks;
+    VkfwCursor          activeCursor; /* NULL for the default cursor */
+    uint64_t            activeCursorSerial; /* 0 for the default cursor */
+    GLFWcursor**        activeCursorFrames; /* the frames of the active cursor at the content scale of this window */
+    uint32_t            activeCursorFrame;
+    uint64_t            nextCursorFrameTime;
+    /* a content scale change that needs a cursor variant which isn't cached yet; the closest cached one is shown until it is created after the
+       platform events, so that the event callback doesn't allocate and downscale */
+    VkfwBool32          cursorVariantPending;
+    float               cursorVariantScale;
+    /* frame deadlines are counted from an origin instead of adding the rounded frame period to the last one, so that the rounding doesn't add up */
+    uint64_t            frameDeadlineOrigin;
+    uint64_t            frameDeadlineIndex;
+    int32_t             frameDeadlineRefreshRate; /* as reported by GLFW, 0 before the first deadline */
+    uint64_t            lastFrameDeadline;
+    /* a framebuffer size settles after the settle period passed without another change. the settled extent is published with a sequence
+       number that is odd while it is being written, so that render threads can read it without locking. */
+    uint64_t                framebufferSettlePeriod; /* in timer ticks */
+    uint64_t                framebufferSettleTime;
+    VkfwBool32              framebufferSettlePending;
+    VkfwExtent2D            pendingFramebufferExtent;
+    atomic_int_least32_t    settledFramebufferWidth;
+    atomic_int_least32_t    settledFramebufferHeight;
+    atomic_uint_least64_t   settledFramebufferSequence;
+    VkfwAllocationCallbacks allocator; /* of the wrapper and the scratch memory of the window functions, see vkfwGetObjectAllocator */
+    VkfwActionMap       actionMap; /* fed with the key and mouse button input, NULL if none */
+    VkfwEventTypeFlags  disabledEventTypes;
+    /* with a textInput callback, the typed characters are encoded into this buffer, which is allocated behind the window, and delivered
+       at the end of the event processing. it has a byte more than its size, for the terminator. */
+    char*               textInputBuffer;
+    uint32_t            textInputBufferSize;
+    uint32_t            textInputByteCount;
+    uint64_t            serial; /* unique per created window, so that traces can tell windows apart across runs and reused memory */
+    VkfwWindow          previousWindow;
+    VkfwWindow          nextWindow;
 } VkfwWindow_t;
 
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateGlobalProperties(VkfwGlobalProperties* pProperties) {
+uint64_t nextWindowSerial = 1;
+
+static uint64_t vkfwGetWindowSerial(VkfwWindow window) {
+    return (window != NULL) ? window[0].serial : 0;
+}
+
+VkfwWindow windowList = NULL; /* all live windows, so that destroying a cursor can reset the windows using it */
+uint32_t animatedCursorWindowCount = 0; /* lets the timers skip walking the window list if no cursor is animated */
+uint32_t pendingFramebufferSettleCount = 0; /* the same for resizes that haven't settled yet */
+uint32_t pendingTextInputWindowCount = 0; /* and for windows with text to deliver */
+uint32_t pendingCursorVariantWindowCount = 0; /* and for windows waiting for a scaled cursor */
+uint64_t timerEventCount = 0; /* events generated by the timers for the application, which end a wait like a platform event */
+
+/* presentation support can't change during the lifetime of a VkInstance, but querying it may be a round trip to the display server.
+   the answers are cached as bitmasks of the first 64 queue families; families above that are always queried. only VkInstances loaded with
+   vkfwLoadVulkanInstanceFunctions are cached, since unloading is the only way to learn that the handle value may be reused by another one.
+   since the Vulkan functions may be called from any thread, the table is guarded by a spinlock, which is never held during a query. */
+#define VKFW_PRESENTATION_SUPPORT_CACHE_SIZE 16
+#define VKFW_PRESENTATION_SUPPORT_CACHED_FAMILIES 64
+
+typedef struct VkfwPresentationSupportCacheEntry {
+    VkfwVkInstance          instance;
+    VkfwVkPhysicalDevice    physicalDevice; /* VK_NULL_HANDLE for unused entries */
+    uint64_t                queriedFamilies;
+    uint64_t                supportedFamilies;
+} VkfwPresentationSupportCacheEntry;
+
+VkfwPresentationSupportCacheEntry presentationSupportCache[VKFW_PRESENTATION_SUPPORT_CACHE_SIZE];
+uint32_t presentationSupportCacheNextEviction = 0;
+atomic_flag presentationSupportCacheLock = ATOMIC_FLAG_INIT;
+
+/* the WSI functions of a VkInstance, resolved once by vkfwLoadVulkanInstanceFunctions. like Vulkan objects, loading and unloading the
+   functions of a VkInstance must not happen while another thread uses that VkInstance with VKFW. */
+#define VKFW_VULKAN_INSTANCE_FUNCTION_TABLE_COUNT 8
+
+typedef struct VkfwVulkanInstanceFunctions {
+    VkInstance                                          instance; /* VK_NULL_HANDLE for unused tables */
+    PFN_vkGetInstanceProcAddr                           vkGetInstanceProcAddr;
+#if defined(VKFW_EXPOSE_NATIVE_WIN32)
+    PFN_vkCreateWin32SurfaceKHR                         vkCreateWin32SurfaceKHR;
+    PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR  vkGetPhysicalDeviceWin32PresentationSupportKHR;
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_WAYLAND)
+    PFN_vkCreateWaylandSurfaceKHR                           vkCreateWaylandSurfaceKHR;
+    PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR    vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_X11)
+    /* only the functions of the surface extension GLFW asks for are loaded, the others stay NULL */
+    PFN_vkCreateXcbSurfaceKHR                           vkCreateXcbSurfaceKHR;
+    PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR    vkGetPhysicalDeviceXcbPresentationSupportKHR;
+    PFN_vkCreateXlibSurfaceKHR                          vkCreateXlibSurfaceKHR;
+    PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR   vkGetPhysicalDeviceXlibPresentationSupportKHR;
+#endif
+} VkfwVulkanInstanceFunctions;
+
+PFN_vkGetInstanceProcAddr desiredVulkanLoader = NULL;
+VkfwVulkanInstanceFunctions vulkanInstanceFunctions[VKFW_VULKAN_INSTANCE_FUNCTION_TABLE_COUNT];
+
+/* cursors are wrapped so that the standard ones can be shared: creating a standard cursor returns the cached object if there is one,
+   and it is only destroyed with its last reference. the serial is unique per created cursor, so that a window can tell if a cursor is
+   the one it already uses even if the memory of a destroyed one got reused. */
+#define VKFW_CURSOR_MAX_SCALE_VARIANTS 4
+
+typedef struct VkfwCursorVariant {
+    VkfwExtent2D    size;
+    GLFWcursor**    frameHandles;
+} VkfwCursorVariant;
+
+typedef struct VkfwCursor_t {
+    GLFWcursor*     cursorHandle; /* the first frame */
+    VkfwCursorShape shape;
+    uint32_t        referenceCount;
+    uint64_t        serial;
+    /* all frames of animated cursors are created up front, so that advancing them only needs glfwSetCursor. still cursors have one frame,
+       and their frameHandles point to cursorHandle. */
+    uint32_t        frameCount;
+    uint64_t        frameDuration; /* in timer ticks */
+    GLFWcursor**    frameHandles;
+    /* only for cursors created with VKFW_CURSOR_CREATE_SCALE_WITH_CONTENT_BIT: the source frames are kept to downscale them for new content scales,
+       the first variant is the base size and its frames are frameHandles. */
+    VkfwImageData*      sourceImages;
+    VkfwExtent2D        baseSize;
+    VkfwOffset2D        baseHotspot;
+    uint32_t            variantCount;
+    VkfwCursorVariant   variants[VKFW_CURSOR_MAX_SCALE_VARIANTS];
+    VkfwAllocationCallbacks allocator; /* of the wrapper and the frame and image memory, see vkfwGetObjectAllocator */
+} VkfwCursor_t;
+
+#define VKFW_STANDARD_CURSOR_SHAPE_COUNT (VKFW_CURSOR_SHAPE_STANDARD_NOT_ALLOWED_CURSOR - VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR + 1)
+
+VkfwCursor standardCursorCache[VKFW_STANDARD_CURSOR_SHAPE_COUNT];
+uint64_t nextCursorSerial = 1;
+
+/* action maps resolve an input with one table lookup: the codes of all devices are laid out one after another, and each has an entry per
+   combination of shift, control, alt and super. compiling picks the most specific binding for every combination up front. */
+#define VKFW_ACTION_MAP_MOUSE_BUTTON_BASE       (VKFW_KEY_LAST + 1)
+#define VKFW_ACTION_MAP_GAMEPAD_BUTTON_BASE     (VKFW_ACTION_MAP_MOUSE_BUTTON_BASE + VKFW_MOUSE_BUTTON_LAST + 1)
+#define VKFW_ACTION_MAP_CODE_COUNT              (VKFW_ACTION_MAP_GAMEPAD_BUTTON_BASE + VKFW_GAMEPAD_BUTTON_LAST + 1)
+#define VKFW_ACTION_MAP_MODIFIER_MASK           (VKFW_MODIFIER_KEY_SHIFT_BIT | VKFW_MODIFIER_KEY_CONTROL_BIT | VKFW_MODIFIER_KEY_ALT_BIT | VKFW_MODIFIER_KEY_SUPER_BIT)
+#define VKFW_ACTION_MAP_MODIFIER_CLASS_COUNT    (VKFW_ACTION_MAP_MODIFIER_MASK + 1)
+#define VKFW_ACTION_NONE                        0xFFFF
+
+typedef struct VkfwActionMap_t {
+    uint16_t                    table[VKFW_ACTION_MAP_CODE_COUNT][VKFW_ACTION_MAP_MODIFIER_CLASS_COUNT];
+    /* the action each held key, mouse button and gamepad button pressed, so that letting go of a modifier first or a rebinding while
+       the input is held still releases it */
+    uint16_t                    pressedActions[VKFW_ACTION_MAP_GAMEPAD_BUTTON_BASE];
+    uint16_t                    gamepadPressedActions[GLFW_JOYSTICK_LAST + 1][VKFW_GAMEPAD_BUTTON_LAST + 1];
+    uint32_t                    actionCount;
+    uint32_t*                   heldCounts; /* the inputs holding each action, since several can be bound to it */
+    uint64_t*                   stateBits;
+    VkfwBool32                  hasGamepadBindings;
+    VkfwActionMapEventCallback  actionEvent;
+    void*                       pUserData;
+    VkfwAllocationCallbacks     allocator; /* of the map and its arrays, see vkfwGetObjectAllocator */
+    VkfwActionMap               previousActionMap;
+    VkfwActionMap               nextActionMap;
+} VkfwActionMap_t;
+
+VkfwActionMap actionMapList = NULL; /* all live action maps, for the gamepad input and to detach them from windows */
+uint32_t gamepadActionMapCount = 0; /* maps with gamepad bindings, which need the joystick events even without joystick callbacks */
+
+static VkfwResult vkfwValidateActionBindings(uint32_t actionCount, uint32_t bindingCount, const VkfwActionBinding* pBindings) {
+    uint32_t i;
+    
+    if(bindingCount > 0 && pBindings == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    for(i = 0; i < bindingCount; i++) {
+        switch(pBindings[i].device) {
+            case VKFW_INPUT_DEVICE_KEYBOARD:
+                if(pBindings[i].code < VKFW_KEY_SPACE || pBindings[i].code > VKFW_KEY_LAST) return VKFW_ERROR_INVALID_ENUM_VALUE;
+                break;
+            case VKFW_INPUT_DEVICE_MOUSE:
+                if(pBindings[i].code < VKFW_MOUSE_BUTTON_1 || pBindings[i].code > VKFW_MOUSE_BUTTON_LAST) return VKFW_ERROR_INVALID_ENUM_VALUE;
+                break;
+            case VKFW_INPUT_DEVICE_GAMEPAD:
+                if(pBindings[i].code < VKFW_GAMEPAD_BUTTON_A || pBindings[i].code > VKFW_GAMEPAD_BUTTON_LAST) return VKFW_ERROR_INVALID_ENUM_VALUE;
+                if(pBindings[i].modifiers != VKFW_MODIFIER_KEY_NONE) return VKFW_ERROR_INVALID_ENUM_VALUE;
+                break;
+            default: return VKFW_ERROR_INVALID_ENUM_VALUE;
+        }
+        if(pBindings[i].modifiers & ~VKFW_ACTION_MAP_MODIFIER_MASK) return VKFW_ERROR_INVALID_ENUM_VALUE;
+        if(pBindings[i].action >= actionCount) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    }
+    
+    return VKFW_SUCCESS;
+}
+static uint32_t vkfwGetActionMapCode(VkfwInputDevice device, int32_t code) {
+    switch(device) {
+        case VKFW_INPUT_DEVICE_MOUSE:   return VKFW_ACTION_MAP_MOUSE_BUTTON_BASE + (uint32_t) code;
+        case VKFW_INPUT_DEVICE_GAMEPAD: return VKFW_ACTION_MAP_GAMEPAD_BUTTON_BASE + (uint32_t) code;
+        default:                        return (uint32_t) code;
+    }
+}
+/* the bindings have to be validated already */
+static void vkfwCompileActionMap(VkfwActionMap actionMap, uint32_t bindingCount, const VkfwActionBinding* pBindings) {
+    uint32_t i, modifierClass;
+    uint8_t specificity[VKFW_ACTION_MAP_CODE_COUNT][VKFW_ACTION_MAP_MODIFIER_CLASS_COUNT]; /* modifiers of the chosen binding plus one, 0 for none */
+    
+    memset(specificity, 0, sizeof(specificity));
+    for(i = 0; i < VKFW_ACTION_MAP_CODE_COUNT; i++) {
+        for(modifierClass = 0; modifierClass < VKFW_ACTION_MAP_MODIFIER_CLASS_COUNT; modifierClass++) actionMap[0].table[i][modifierClass] = VKFW_ACTION_NONE;
+    }
+    actionMap[0].hasGamepadBindings = VKFW_FALSE;
+    
+    /* a binding applies to every combination containing its modifiers, and wins over earlier bindings requiring fewer of them */
+    for(i = 0; i < bindingCount; i++) {
+        uint32_t code = vkfwGetActionMapCode(pBindings[i].device, pBindings[i].code);
+        uint32_t modifiers = pBindings[i].modifiers;
+        uint8_t bindingSpecificity = (uint8_t) (1 + ((modifiers >> 3) & 1) + ((modifiers >> 2) & 1) + ((modifiers >> 1) & 1) + (modifiers & 1));
+        for(modifierClass = 0; modifierClass < VKFW_ACTION_MAP_MODIFIER_CLASS_COUNT; modifierClass++) {
+            if((modifierClass & modifiers) != modifiers) continue;
+            if(specificity[code][modifierClass] >= bindingSpecificity) continue;
+            specificity[code][modifierClass] = bindingSpecificity;
+            actionMap[0].table[code][modifierClass] = (uint16_t) pBindings[i].action;
+        }
+        if(pBindings[i].device == VKFW_INPUT_DEVICE_GAMEPAD) actionMap[0].hasGamepadBindings = VKFW_TRUE;
+    }
+}
+static void vkfwPressAction(VkfwActionMap actionMap, VkfwWindow window, uint16_t action) {
+    if(actionMap[0].heldCounts[action]++ > 0) return;
+    actionMap[0].stateBits[action / 64] |= (uint64_t) 1 << (action % 64);
+    if(actionMap[0].actionEvent != NULL) VKFW_TRACED_CALLBACK("actionEvent", window, actionMap[0].actionEvent(actionMap, window, action, VKFW_ACTION_PRESS, actionMap[0].pUserData));
+}
+static void vkfwReleaseAction(VkfwActionMap actionMap, VkfwWindow window, uint16_t action) {
+    if(actionMap[0].heldCounts[action] == 0) return; /* held across vkfwSetActionMapBindings, which released it already */
+    if(--actionMap[0].heldCounts[action] > 0) return;
+    actionMap[0].stateBits[action / 64] &= ~((uint64_t) 1 << (action % 64));
+    if(actionMap[0].actionEvent != NULL) VKFW_TRACED_CALLBACK("actionEvent", window, actionMap[0].actionEvent(actionMap, window, action, VKFW_ACTION_RELEASE, actionMap[0].pUserData));
+}
+static void vkfwResetPressedActions(VkfwActionMap actionMap) {
+    uint32_t i, j;
+    
+    for(i = 0; i < VKFW_ACTION_MAP_GAMEPAD_BUTTON_BASE; i++) actionMap[0].pressedActions[i] = VKFW_ACTION_NONE;
+    for(i = 0; i <= GLFW_JOYSTICK_LAST; i++) {
+        for(j = 0; j <= VKFW_GAMEPAD_BUTTON_LAST; j++) actionMap[0].gamepadPressedActions[i][j] = VKFW_ACTION_NONE;
+    }
+}
+static void vkfwReleaseAllActions(VkfwActionMap actionMap) {
+    uint32_t i;
+    
+    vkfwResetPressedActions(actionMap);
+    for(i = 0; i < actionMap[0].actionCount; i++) {
+        if(actionMap[0].heldCounts[i] == 0) continue;
+        actionMap[0].heldCounts[i] = 1;
+        vkfwReleaseAction(actionMap, NULL, (uint16_t) i);
+    }
+}
+/* for keys and mouse buttons; repeats don't change any action */
+static void vkfwDispatchActionInput(VkfwActionMap actionMap, VkfwWindow window, uint32_t code, int action, int mods) {
+    if(action == GLFW_PRESS) {
+        if(actionMap[0].pressedActions[code] != VKFW_ACTION_NONE) return;
+        uint16_t mappedAction = actionMap[0].table[code][mods & VKFW_ACTION_MAP_MODIFIER_MASK];
+        if(mappedAction == VKFW_ACTION_NONE) return;
+        actionMap[0].pressedActions[code] = mappedAction;
+        vkfwPressAction(actionMap, window, mappedAction);
+    } else if(action == GLFW_RELEASE) {
+        uint16_t pressedAction = actionMap[0].pressedActions[code];
+        if(pressedAction == VKFW_ACTION_NONE) return;
+        actionMap[0].pressedActions[code] = VKFW_ACTION_NONE;
+        vkfwReleaseAction(actionMap, window, pressedAction);
+    }
+}
+static void vkfwUpdateJoystickEventsEnabled(void) {
+    int32_t jid;
+    VkfwBool32 enabled = (joystickCallbacksEnabled || gamepadActionMapCount > 0) ? VKFW_TRUE : VKFW_FALSE;
+    
+    /* the snapshots weren't kept up to date while the events were disabled */
+    if(enabled && !joystickEventsEnabled) {
+        for(jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; jid++) joystickSnapshotValid[jid] = VKFW_FALSE;
+    }
+    joystickEventsEnabled = enabled;
+}
+static void vkfwDispatchGamepadActions(int32_t jid, VkfwGamepadButton button, VkfwAction state) {
+    VkfwActionMap actionMap;
+    
+    for(actionMap = actionMapList; actionMap != NULL; actionMap = actionMap[0].nextActionMap) {
+        uint16_t* pPressedAction = &actionMap[0].gamepadPressedActions[jid][button];
+        if(state == VKFW_ACTION_PRESS) {
+            if(!actionMap[0].hasGamepadBindings || pPressedAction[0] != VKFW_ACTION_NONE) continue;
+            uint16_t mappedAction = actionMap[0].table[VKFW_ACTION_MAP_GAMEPAD_BUTTON_BASE + button][0];
+            if(mappedAction == VKFW_ACTION_NONE) continue;
+            pPressedAction[0] = mappedAction;
+            vkfwPressAction(actionMap, NULL, mappedAction);
+        } else {
+            uint16_t pressedAction = pPressedAction[0];
+            if(pressedAction == VKFW_ACTION_NONE) continue;
+            pPressedAction[0] = VKFW_ACTION_NONE;
+            vkfwReleaseAction(actionMap, NULL, pressedAction);
+        }
+    }
+}
+
+/* GLFW takes non-premultiplied RGBA8 images. downscaling averages premultiplied colors, so that transparent pixels don't bleed dark fringes
+   into the edges, with one pixel in a 4-wide float vector. that maps directly onto SSE2 registers where we have them. */
+#ifdef VKFW_RESAMPLE_SSE2
+typedef __m128 VkfwPixel;
+
+static inline VkfwPixel vkfwPixelZero(void) {
+    return _mm_setzero_ps();
+}
+static inline VkfwPixel vkfwPixelLoad(const float* pValues) {
+    return _mm_loadu_ps(pValues);
+}
+static inline void vkfwPixelStore(float* pValues, VkfwPixel pixel) {
+    _mm_storeu_ps(pValues, pixel);
+}
+static inline VkfwPixel vkfwPixelAddWeighted(VkfwPixel accumulator, VkfwPixel pixel, float weight) {
+    return _mm_add_ps(accumulator, _mm_mul_ps(pixel, _mm_set1_ps(weight)));
+}
+static inline VkfwPixel vkfwPixelPremultiply(const uint8_t* pRGBA) {
+    int32_t packed;
+    memcpy(&packed, pRGBA, 4);
+    __m128i integers = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), _mm_setzero_si128()), _mm_setzero_si128());
+    __m128 pixel = _mm_cvtepi32_ps(integers);
+    __m128 alpha = _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3));
+    /* (a/255, a/255, a/255, 1) */
+    __m128 factor = _mm_add_ps(_mm_mul_ps(alpha, _mm_set_ps(0.0f, 1.0f/255.0f, 1.0f/255.0f, 1.0f/255.0f)), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+    return _mm_mul_ps(pixel, factor);
+}
+static inline void vkfwPixelUnpremultiply(VkfwPixel pixel, uint8_t* pRGBA) {
+    int32_t packed;
+    __m128 alpha = _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128 visible = _mm_cmpgt_ps(alpha, _mm_setzero_ps());
+    /* (255/a, 255/a, 255/a, 1), with 0 instead of 255/a for fully transparent pixels */
+    __m128 factor = _mm_and_ps(_mm_div_ps(_mm_set1_ps(255.0f), alpha), _mm_and_ps(visible, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))));
+    factor = _mm_or_ps(factor, _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+    pixel = _mm_min_ps(_mm_max_ps(_mm_mul_ps(pixel, factor), _mm_setzero_ps()), _mm_set1_ps(255.0f));
+    __m128i integers = _mm_cvtps_epi32(pixel);
+    integers = _mm_packus_epi16(_mm_packs_epi32(integers, integers), integers);
+    packed = _mm_cvtsi128_si32(integers);
+    memcpy(pRGBA, &packed, 4);
+}
+#else
+typedef struct VkfwPixel {
+    float channels[4];
+} VkfwPixel;
+
+static inline VkfwPixel vkfwPixelZero(void) {
+    VkfwPixel pixel = {{0.0f, 0.0f, 0.0f, 0.0f}};
+    return pixel;
+}
+static inline VkfwPixel vkfwPixelLoad(const float* pValues) {
+    VkfwPixel pixel = {{pValues[0], pValues[1], pValues[2], pValues[3]}};
+    return pixel;
+}
+static inline void vkfwPixelStore(float* pValues, VkfwPixel pixel) {
+    memcpy(pValues, pixel.channels, sizeof(pixel.channels));
+}
+static inline VkfwPixel vkfwPixelAddWeighted(VkfwPixel accumulator, VkfwPixel pixel, float weight) {
+    uint32_t i;
+    for(i = 0; i < 4; i++) accumulator.channels[i] += pixel.channels[i] * weight;
+    return accumulator;
+}
+static inline VkfwPixel vkfwPixelPremultiply(const uint8_t* pRGBA) {
+    float alpha = pRGBA[3] / 255.0f;
+    VkfwPixel pixel = {{pRGBA[0] * alpha, pRGBA[1] * alpha, pRGBA[2] * alpha, pRGBA[3]}};
+    return pixel;
+}
+static inline void vkfwPixelUnpremultiply(VkfwPixel pixel, uint8_t* pRGBA) {
+    uint32_t i;
+    float factor = (pixel.channels[3] > 0.0f) ? 255.0f / pixel.channels[3] : 0.0f;
+    for(i = 0; i < 4; i++) {
+        float value = (i == 3) ? pixel.channels[i] : pixel.channels[i] * factor;
+        value = (value < 0.0f) ? 0.0f : ((value > 255.0f) ? 255.0f : value);
+        pRGBA[i] = (uint8_t) (value + 0.5f);
+    }
+}
+#endif
+
+/* the source pixels covering one destination pixel along one axis of a box filter. the first and last source pixel may only be partially covered. */
+typedef struct VkfwBoxSpan {
+    int32_t first;
+    int32_t count;
+    float   firstWeight;
+    float   innerWeight;
+    float   lastWeight;
+} VkfwBoxSpan;
+
+static void vkfwComputeBoxSpans(int32_t sourceSize, int32_t destinationSize, VkfwBoxSpan* pSpans) {
+    int32_t i, last;
+    float ratio = (float) sourceSize / (float) destinationSize;
+    
+    for(i = 0; i < destinationSize; i++) {
+        float start = i * ratio;
+        float end   = (i + 1) * ratio;
+        pSpans[i].first = (int32_t) floorf(start);
+        last = (int32_t) ceilf(end) - 1;
+        if(last > sourceSize - 1) last = sourceSize - 1;
+        if(last < pSpans[i].first) last = pSpans[i].first;
+        pSpans[i].count         = last - pSpans[i].first + 1;
+        pSpans[i].innerWeight   = 1.0f / ratio;
+        pSpans[i].firstWeight   = (((end < pSpans[i].first + 1) ? end : (float) (pSpans[i].first + 1)) - start) / ratio;
+        pSpans[i].lastWeight    = (end - ((start > last) ? start : (float) last)) / ratio;
+    }
+}
+static inline float vkfwBoxSpanWeight(const VkfwBoxSpan* pSpan, int32_t index) {
+    if(index == 0) return pSpan[0].firstWeight;
+    if(index == pSpan[0].count - 1) return pSpan[0].lastWeight;
+    return pSpan[0].innerWeight;
+}
+
+/* downscales pSource to the size and into the pixels given in pDestination with a premultiplied alpha box filter. first every source row is
+   reduced horizontally, then the reduced rows are combined vertically. */
+static VkfwResult vkfwDownscaleImage(const VkfwImageData* pSource, const VkfwImageData* pDestination, const VkfwAllocationCallbacks* pAllocator) {
+    int32_t x, y, i;
+    VkfwPixel accumulator;
+    
+    VkfwBoxSpan* spans      = vkfwAllocateWith(pAllocator, (pDestination[0].width + pDestination[0].height) * sizeof(VkfwBoxSpan), VKFW_ALLOCATION_SUBSYSTEM_INTERNAL);
+    float* reducedRows      = vkfwAllocateWith(pAllocator, (size_t) pSource[0].height * pDestination[0].width * 4 * sizeof(float), VKFW_ALLOCATION_SUBSYSTEM_INTERNAL);
+    if(spans == NULL || reducedRows == NULL) {
+        vkfwFreeWith(pAllocator, spans);
+        vkfwFreeWith(pAllocator, reducedRows);
+        return VKFW_ERROR_OUT_OF_MEMORY;
+    }
+    VkfwBoxSpan* columnSpans = spans;
+    VkfwBoxSpan* rowSpans    = spans + pDestination[0].width;
+    vkfwComputeBoxSpans(pSource[0].width,  pDestination[0].width,  columnSpans);
+    vkfwComputeBoxSpans(pSource[0].height, pDestination[0].height, rowSpans);
+    
+    for(y = 0; y < pSource[0].height; y++) {
+        const uint8_t* sourceRow = pSource[0].pixels + (size_t) y * pSource[0].width * 4;
+        float* reducedRow = reducedRows + (size_t) y * pDestination[0].width * 4;
+        for(x = 0; x < pDestination[0].width; x++) {
+            accumulator = vkfwPixelZero();
+            for(i = 0; i < columnSpans[x].count; i++) {
+                accumulator = vkfwPixelAddWeighted(accumulator, vkfwPixelPremultiply(sourceRow + (size_t) (columnSpans[x].first + i) * 4), vkfwBoxSpanWeight(&columnSpans[x], i));
+            }
+            vkfwPixelStore(reducedRow + (size_t) x * 4, accumulator);
+        }
+    }
+    for(y = 0; y < pDestination[0].height; y++) {
+        uint8_t* destinationRow = pDestination[0].pixels + (size_t) y * pDestination[0].width * 4;
+        for(x = 0; x < pDestination[0].width; x++) {
+            accumulator = vkfwPixelZero();
+            for(i = 0; i < rowSpans[y].count; i++) {
+                accumulator = vkfwPixelAddWeighted(accumulator, vkfwPixelLoad(reducedRows + ((size_t) (rowSpans[y].first + i) * pDestination[0].width + x) * 4), vkfwBoxSpanWeight(&rowSpans[y], i));
+            }
+            vkfwPixelUnpremultiply(accumulator, destinationRow + (size_t) x * 4);
+        }
+    }
+    
+    vkfwFreeWith(pAllocator, spans);
+    vkfwFreeWith(pAllocator, reducedRows);
+    return VKFW_SUCCESS;
+}
+
+/* creates the GLFW cursors for all frames of a scaling cursor, downscaled from the source frames to the given size */
+static VkfwResult vkfwCreateCursorVariant(VkfwCursor cursor, VkfwExtent2D size, VkfwCursorVariant* pVariant) {
+    uint32_t i, j;
+    VkfwImageData image;
+    GLFWimage glfwImage;
+    int32_t hotspotX, hotspotY;
+    VkfwResult result = VKFW_SUCCESS;
+    
+    pVariant[0].size = size;
+    pVariant[0].frameHandles = vkfwAllocateWith(vkfwGetObjectAllocator(&cursor[0].allocator), cursor[0].frameCount * sizeof(GLFWcursor*), VKFW_ALLOCATION_SUBSYSTEM_CURSOR);
+    image.width  = size.width;
+    image.height = size.height;
+    image.pixels = vkfwAllocateWith(vkfwGetObjectAllocator(&cursor[0].allocator), (size_t) image.width * image.height * 4, VKFW_ALLOCATION_SUBSYSTEM_CURSOR);
+    if(pVariant[0].frameHandles == NULL || image.pixels == NULL) {
+        vkfwFreeWith(vkfwGetObjectAllocator(&cursor[0].allocator), pVariant[0].frameHandles);
+        vkfwFreeWith(vkfwGetObjectAllocator(&cursor[0].allocator), image.pixels);
+        return VKFW_ERROR_OUT_OF_MEMORY;
+    }
+    hotspotX = (int32_t) ((float) cursor[0].baseHotspot.x * image.width  / cursor[0].baseSize.width  + 0.5f);
+    hotspotY = (int32_t) ((float) cursor[0].baseHotspot.y * image.height / cursor[0].baseSize.height + 0.5f);
+    if(hotspotX >= image.width)  hotspotX = image.width  - 1;
+    if(hotspotY >= image.height) hotspotY = image.height - 1;
+    glfwImage.width  = image.width;
+    glfwImage.height = image.height;
+    glfwImage.pixels = image.pixels;
+    
+    for(i = 0; i < cursor[0].frameCount; i++) {
+        result = vkfwDownscaleImage(&cursor[0].sourceImages[i], &image, vkfwGetObjectAllocator(&cursor[0].allocator));
+        if(result != VKFW_SUCCESS) break;
+        pVariant[0].frameHandles[i] = glfwCreateCursor(&glfwImage, hotspotX, hotspotY);
+        if(pVariant[0].frameHandles[i] == NULL) {
+            switch(glfwGetError(NULL)) {
+                case GLFW_INVALID_VALUE: result = VKFW_ERROR_INVALID_NUMERIC_VALUE; break;
+                case GLFW_PLATFORM_ERROR: result = VKFW_ERROR_PLATFORM_ERROR; break;
+                default: result = VKFW_ERROR_UNKNOWN; break;
+            }
+            break;
+        }
+    }
+    vkfwFreeWith(vkfwGetObjectAllocator(&cursor[0].allocator), image.pixels);
+    
+    if(result != VKFW_SUCCESS) {
+        for(j = 0; j < i; j++) glfwDestroyCursor(pVariant[0].frameHandles[j]);
+        glfwGetError(NULL);
+        vkfwFreeWith(vkfwGetObjectAllocator(&cursor[0].allocator), pVariant[0].frameHandles);
+        return result;
+    }
+    
+    return VKFW_SUCCESS;
+}
+/* how far a variant is from the wanted size, as the larger relative error of its two dimensions */
+static float vkfwGetCursorVariantError(VkfwExtent2D variantSize, VkfwExtent2D size) {
+    float widthError  = fabsf((float) (variantSize.width  - size.width))  / (float) size.width;
+    float heightError = fabsf((float) (variantSize.height - size.height)) / (float) size.height;
+    return (widthError > heightError) ? widthError : heightError;
+}
+/* returns the frames to use at the given content scale. for cursors scaling with the content, those are the cached variant for the size,
+   created on first use if createMissing is set. once all variant slots are taken or without createMissing, the closest cached size is used
+   instead, and pVariantMissing tells if a variant could still be created for it. */
+static VkfwResult vkfwGetCursorVariant(VkfwCursor cursor, float scale, VkfwBool32 createMissing, GLFWcursor*** pFrameHandles, VkfwBool32* pVariantMissing) {
+    uint32_t i, closest;
+    VkfwExtent2D size;
+    VkfwResult result;
+    
+    pVariantMissing[0] = VKFW_FALSE;
+    if(cursor[0].variantCount == 0) {
+        pFrameHandles[0] = cursor[0].frameHandles;
+        return VKFW_SUCCESS;
+    }
+    
+    size.width  = (int32_t) (cursor[0].baseSize.width  * scale + 0.5f);
+    size.height = (int32_t) (cursor[0].baseSize.height * scale + 0.5f);
+    if(size.width  < 1) size.width  = 1;
+    if(size.height < 1) size.height = 1;
+    if(size.width  > cursor[0].sourceImages[0].width)  size.width  = cursor[0].sourceImages[0].width;
+    if(size.height > cursor[0].sourceImages[0].height) size.height = cursor[0].sourceImages[0].height;
+    
+    closest = 0;
+    for(i = 0; i < cursor[0].variantCount; i++) {
+        if(cursor[0].variants[i].size.width == size.width && cursor[0].variants[i].size.height == size.height) {
+            pFrameHandles[0] = cursor[0].variants[i].frameHandles;
+            return VKFW_SUCCESS;
+        }
+        if(vkfwGetCursorVariantError(cursor[0].variants[i].size, size) < vkfwGetCursorVariantError(cursor[0].variants[closest].size, size)) closest = i;
+    }
+    if(cursor[0].variantCount == VKFW_CURSOR_MAX_SCALE_VARIANTS || !createMissing) {
+        pFrameHandles[0] = cursor[0].variants[closest].frameHandles;
+        pVariantMissing[0] = (cursor[0].variantCount < VKFW_CURSOR_MAX_SCALE_VARIANTS) ? VKFW_TRUE : VKFW_FALSE;
+        return VKFW_SUCCESS;
+    }
+    
+    result = vkfwCreateCursorVariant(cursor, size, &cursor[0].variants[cursor[0].variantCount]);
+    if(result != VKFW_SUCCESS) return result;
+    
+    pFrameHandles[0] = cursor[0].variants[cursor[0].variantCount].frameHandles;
+    cursor[0].variantCount++;
+    
+    return VKFW_SUCCESS;
+}
+/* changes which cursor a window shows, keeping the count of windows with an animated cursor */
+static void vkfwSetActiveCursor(VkfwWindow window, VkfwCursor cursor, GLFWcursor** frameHandles) {
+    if(window[0].activeCursor != NULL && window[0].activeCursor[0].frameCount > 1) animatedCursorWindowCount--;
+    if(window[0].cursorVariantPending) {
+        window[0].cursorVariantPending = VKFW_FALSE;
+        pendingCursorVariantWindowCount--;
+    }
+    if(cursor != NULL && cursor[0].frameCount > 1) animatedCursorWindowCount++;
+    
+    window[0].activeCursor          = cursor;
+    window[0].activeCursorSerial    = (cursor != NULL) ? cursor[0].serial : 0;
+    window[0].activeCursorFrames    = frameHandles;
+    window[0].activeCursorFrame     = 0;
+    if(cursor != NULL) window[0].nextCursorFrameTime = glfwGetTimerValue() + cursor[0].frameDuration;
+}
+
+/* installed unless the window disables content scale changes, to swap a scaling cursor to the closest cached size before forwarding the
+   event. a missing size is created by vkfwUpdateCursorVariants after the platform events. */
+static void vkfwWindowContentScaleTrampoline(GLFWwindow* windowHandle, float xScale, float yScale) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    GLFWcursor** frameHandles;
+    VkfwBool32 variantMissing;
+    
+    if(window == NULL) return;
+    if(window[0].activeCursor != NULL && window[0].activeCursor[0].variantCount > 0) {
+        float scale = (xScale > yScale) ? xScale : yScale;
+        vkfwGetCursorVariant(window[0].activeCursor, scale, VKFW_FALSE, &frameHandles, &variantMissing);
+        if(frameHandles != window[0].activeCursorFrames) {
+            window[0].activeCursorFrames = frameHandles;
+            glfwSetCursor(windowHandle, frameHandles[window[0].activeCursorFrame]);
+        }
+        if(variantMissing != window[0].cursorVariantPending) {
+            if(variantMissing) pendingCursorVariantWindowCount++; else pendingCursorVariantWindowCount--;
+            window[0].cursorVariantPending = variantMissing;
+        }
+        window[0].cursorVariantScale = scale;
+    }
+    if(window[0].callbacks.contentScaleChange != NULL) VKFW_TRACED_CALLBACK("contentScaleChange", window, window[0].callbacks.contentScaleChange(window, xScale, yScale, window[0].callbacks.pUserData));
+}
+/* installed unless the window disables focus changes, since gaining focus is where a layout change becomes visible */
+static void vkfwWindowFocusTrampoline(GLFWwindow* windowHandle, int focused) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(focused) keyTablesValid = VKFW_FALSE;
+    if(window == NULL) return;
+    if(window[0].callbacks.focusChange != NULL) VKFW_TRACED_CALLBACK("focusChange", window, window[0].callbacks.focusChange(window, focused ? VKFW_TRUE : VKFW_FALSE, window[0].callbacks.pUserData));
+}
+static void vkfwDeliverTextInput(VkfwWindow window) {
+    uint32_t byteCount = window[0].textInputByteCount;
+    
+    window[0].textInputByteCount = 0;
+    pendingTextInputWindowCount--;
+    window[0].textInputBuffer[byteCount] = '\0';
+    VKFW_TRACED_CALLBACK("textInput", window, window[0].callbacks.textInput(window, window[0].textInputBuffer, byteCount, window[0].callbacks.pUserData));
+}
+/* creates the cursor variants the content scale changes of the platform events asked for; a failure keeps the closest cached variant */
+static void vkfwUpdateCursorVariants(void) {
+    VkfwWindow window;
+    GLFWcursor** frameHandles;
+    VkfwBool32 variantMissing;
+    
+    if(pendingCursorVariantWindowCount == 0) return;
+    for(window = windowList; window != NULL; window = window[0].nextWindow) {
+        if(!window[0].cursorVariantPending) continue;
+        window[0].cursorVariantPending = VKFW_FALSE;
+        pendingCursorVariantWindowCount--;
+        if(vkfwGetCursorVariant(window[0].activeCursor, window[0].cursorVariantScale, VKFW_TRUE, &frameHandles, &variantMissing) == VKFW_SUCCESS) {
+            window[0].activeCursorFrames = frameHandles;
+            glfwSetCursor(window[0].windowHandle, frameHandles[window[0].activeCursorFrame]);
+        }
+        glfwGetError(NULL);
+    }
+}
+/* called at the end of every event processing */
+static void vkfwFlushTextInput(void) {
+    VkfwWindow window, nextWindow;
+    
+    /* the callback may destroy any window, so the list is walked again from its head after each one. delivered windows have nothing pending anymore. */
+    for(window = windowList; window != NULL && pendingTextInputWindowCount > 0; window = nextWindow) {
+        nextWindow = window[0].nextWindow;
+        if(window[0].textInputByteCount == 0) continue;
+        vkfwDeliverTextInput(window);
+        nextWindow = windowList;
+    }
+}
+/* installed for windows with a character or text input callback, unless they disable character input. GLFW only delivers valid scalar
+   values, so the encoding doesn't need to check for surrogates. */
+static void vkfwWindowCharTrampoline(GLFWwindow* windowHandle, unsigned int codepoint) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    uint8_t encoded[4];
+    uint32_t length;
+    
+    if(window == NULL) return;
+    if(window[0].callbacks.unicodeCharacterInput != NULL) VKFW_TRACED_CALLBACK("unicodeCharacterInput", window, window[0].callbacks.unicodeCharacterInput(window, codepoint, window[0].callbacks.pUserData));
+    if(window[0].textInputBuffer == NULL) return;
+    
+    if(codepoint < 0x80) {
+        encoded[0] = (uint8_t) codepoint;
+        length = 1;
+    } else if(codepoint < 0x800) {
+        encoded[0] = (uint8_t) (0xC0 | (codepoint >> 6));
+        encoded[1] = (uint8_t) (0x80 | (codepoint & 0x3F));
+        length = 2;
+    } else if(codepoint < 0x10000) {
+        encoded[0] = (uint8_t) (0xE0 | (codepoint >> 12));
+        encoded[1] = (uint8_t) (0x80 | ((codepoint >> 6) & 0x3F));
+        encoded[2] = (uint8_t) (0x80 | (codepoint & 0x3F));
+        length = 3;
+    } else {
+        encoded[0] = (uint8_t) (0xF0 | (codepoint >> 18));
+        encoded[1] = (uint8_t) (0x80 | ((codepoint >> 12) & 0x3F));
+        encoded[2] = (uint8_t) (0x80 | ((codepoint >> 6) & 0x3F));
+        encoded[3] = (uint8_t) (0x80 | (codepoint & 0x3F));
+        length = 4;
+    }
+    
+    /* a full buffer is delivered early rather than growing it while events are processed */
+    if(window[0].textInputBufferSize - window[0].textInputByteCount < length) vkfwDeliverTextInput(window);
+    if(window[0].textInputByteCount == 0) pendingTextInputWindowCount++;
+    memcpy(&window[0].textInputBuffer[window[0].textInputByteCount], encoded, length);
+    window[0].textInputByteCount += length;
+}
+/* installed unless the window disables key input, even without a key callback, so that an action map can be attached at any time */
+static void vkfwWindowKeyTrampoline(GLFWwindow* windowHandle, int key, int scancode, int action, int mods) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL) return;
+    if(window[0].callbacks.keyInput != NULL) VKFW_TRACED_CALLBACK("keyInput", window, window[0].callbacks.keyInput(window, (VkfwKey) key, scancode, (VkfwKeyAction) action, (VkfwModifierKeyMask) mods, window[0].callbacks.pUserData));
+    if(window[0].actionMap != NULL && key >= VKFW_KEY_SPACE && key <= VKFW_KEY_LAST) vkfwDispatchActionInput(window[0].actionMap, window, (uint32_t) key, action, mods);
+}
+static void vkfwWindowMouseButtonTrampoline(GLFWwindow* windowHandle, int button, int action, int mods) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL) return;
+    if(window[0].callbacks.mouseButtonInput != NULL) VKFW_TRACED_CALLBACK("mouseButtonInput", window, window[0].callbacks.mouseButtonInput(window, (VkfwMouseButton) button, (VkfwAction) action, (VkfwModifierKeyMask) mods, window[0].callbacks.pUserData));
+    if(window[0].actionMap != NULL && button >= VKFW_MOUSE_BUTTON_1 && button <= VKFW_MOUSE_BUTTON_LAST) vkfwDispatchActionInput(window[0].actionMap, window, VKFW_ACTION_MAP_MOUSE_BUTTON_BASE + (uint32_t) button, action, mods);
+}
+static void vkfwPublishFramebufferExtent(VkfwWindow window, VkfwExtent2D extent) {
+    atomic_fetch_add(&window[0].settledFramebufferSequence, 1);
+    atomic_store(&window[0].settledFramebufferWidth,  extent.width);
+    atomic_store(&window[0].settledFramebufferHeight, extent.height);
+    atomic_fetch_add(&window[0].settledFramebufferSequence, 1);
+}
+/* installed unless the window disables framebuffer size changes, to restart the settle period of the framebuffer size on each change */
+static void vkfwWindowFramebufferSizeTrampoline(GLFWwindow* windowHandle, int width, int height) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL) return;
+    if(!window[0].framebufferSettlePending) pendingFramebufferSettleCount++;
+    window[0].framebufferSettlePending          = VKFW_TRUE;
+    window[0].framebufferSettleTime             = glfwGetTimerValue() + window[0].framebufferSettlePeriod;
+    window[0].pendingFramebufferExtent.width    = width;
+    window[0].pendingFramebufferExtent.height   = height;
+    if(window[0].callbacks.framebufferSizeChange != NULL) VKFW_TRACED_CALLBACK("framebufferSizeChange", window, window[0].callbacks.framebufferSizeChange(window, width, height, window[0].callbacks.pUserData));
+}
+/* installed for windows with a path drop callback, so that the paths outlive the callback like the other returned strings. the array and the
+   strings share one scratch allocation; if it fails, the callback gets GLFW's paths, which at least stay valid for its duration */
+static void vkfwWindowPathDropTrampoline(GLFWwindow* windowHandle, int pathCount, const char** paths) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    int i;
+    
+    if(window == NULL || window[0].callbacks.pathDrop == NULL) return;
+    size_t size = pathCount * sizeof(const char*);
+    for(i = 0; i < pathCount; i++) size += strlen(paths[i]) + 1;
+    const char** pathCopies = vkfwAllocateScratch(size);
+    if(pathCopies != NULL) {
+        char* pCopy = (char*) &pathCopies[pathCount];
+        for(i = 0; i < pathCount; i++) {
+            size_t pathSize = strlen(paths[i]) + 1;
+            memcpy(pCopy, paths[i], pathSize);
+            pathCopies[i] = pCopy;
+            pCopy += pathSize;
+        }
+    } else {
+        pathCopies = paths;
+    }
+    VKFW_TRACED_CALLBACK("pathDrop", window, window[0].callbacks.pathDrop(window, pathCount, pathCopies, window[0].callbacks.pUserData));
+}
+/* the callbacks VKFW only forwards get their trampolines installed if the window has them, to pass the window and the user data */
+static void vkfwWindowPositionTrampoline(GLFWwindow* windowHandle, int xPosition, int yPosition) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.positionChange == NULL) return;
+    VKFW_TRACED_CALLBACK("positionChange", window, window[0].callbacks.positionChange(window, xPosition, yPosition, window[0].callbacks.pUserData));
+}
+static void vkfwWindowSizeTrampoline(GLFWwindow* windowHandle, int width, int height) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.sizeChange == NULL) return;
+    VKFW_TRACED_CALLBACK("sizeChange", window, window[0].callbacks.sizeChange(window, width, height, window[0].callbacks.pUserData));
+}
+static void vkfwWindowCursorPositionTrampoline(GLFWwindow* windowHandle, double xPosition, double yPosition) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.cursorPositionChange == NULL) return;
+    VKFW_TRACED_CALLBACK("cursorPositionChange", window, window[0].callbacks.cursorPositionChange(window, xPosition, yPosition, window[0].callbacks.pUserData));
+}
+static void vkfwWindowIconifyTrampoline(GLFWwindow* windowHandle, int iconified) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.iconficationChange == NULL) return;
+    VKFW_TRACED_CALLBACK("iconficationChange", window, window[0].callbacks.iconficationChange(window, iconified ? VKFW_TRUE : VKFW_FALSE, window[0].callbacks.pUserData));
+}
+static void vkfwWindowMaximizeTrampoline(GLFWwindow* windowHandle, int maximized) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.maximizationChange == NULL) return;
+    VKFW_TRACED_CALLBACK("maximizationChange", window, window[0].callbacks.maximizationChange(window, maximized ? VKFW_TRUE : VKFW_FALSE, window[0].callbacks.pUserData));
+}
+static void vkfwWindowCloseTrampoline(GLFWwindow* windowHandle) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.closeButtonClicked == NULL) return;
+    VKFW_TRACED_CALLBACK("closeButtonClicked", window, window[0].callbacks.closeButtonClicked(window, window[0].callbacks.pUserData));
+}
+static void vkfwWindowRefreshTrampoline(GLFWwindow* windowHandle) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.contentAreaNeedsToBeRedrawn == NULL) return;
+    VKFW_TRACED_CALLBACK("contentAreaNeedsToBeRedrawn", window, window[0].callbacks.contentAreaNeedsToBeRedrawn(window, window[0].callbacks.pUserData));
+}
+static void vkfwWindowScrollTrampoline(GLFWwindow* windowHandle, double xAxisOffset, double yAxisOffset) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.scrollInput == NULL) return;
+    VKFW_TRACED_CALLBACK("scrollInput", window, window[0].callbacks.scrollInput(window, xAxisOffset, yAxisOffset, window[0].callbacks.pUserData));
+}
+static void vkfwWindowCursorEnterTrampoline(GLFWwindow* windowHandle, int entered) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.cursorEnterOrLeaveContentArea == NULL) return;
+    VKFW_TRACED_CALLBACK("cursorEnterOrLeaveContentArea", window, window[0].callbacks.cursorEnterOrLeaveContentArea(window, entered ? VKFW_TRUE : VKFW_FALSE, window[0].callbacks.pUserData));
+}
+static void vkfwWindowCharModsTrampoline(GLFWwindow* windowHandle, unsigned int codepoint, int mods) {
+    VkfwWindow window = (VkfwWindow) glfwGetWindowUserPointer(windowHandle);
+    
+    if(window == NULL || window[0].callbacks.unicodeCharacterInputWithModifiers == NULL) return;
+    VKFW_TRACED_CALLBACK("unicodeCharacterInputWithModifiers", window, window[0].callbacks.unicodeCharacterInputWithModifiers(window, codepoint, (VkfwModifierKeyMask) mods, window[0].callbacks.pUserData));
+}
+/* monitors are GLFW handles, so only the user data is added */
+static void vkfwMonitorConnectionTrampoline(GLFWmonitor* monitorHandle, int event) {
+    if(instanceCallbacks.monitorConnection == NULL) return;
+    VKFW_TRACED_CALLBACK("monitorConnection", NULL, instanceCallbacks.monitorConnection((VkfwMonitor) monitorHandle, (VkfwConnectionEvent) event, instanceCallbacks.pUserData));
+}
+/* installed for every instance, since a joystick reconnected between two samples must not continue the samples of the previous one */
+static void vkfwJoystickConnectionTrampoline(int jid, int event) {
+    if(event == GLFW_DISCONNECTED) joystickSampleRings[jid].connected = VKFW_FALSE;
+    if(instanceCallbacks.joystickConnection == NULL) return;
+    VKFW_TRACED_CALLBACK("joystickConnection", NULL, instanceCallbacks.joystickConnection((VkfwJoystick) jid, (VkfwConnectionEvent) event, instanceCallbacks.pUserData));
+}
+
+static VkfwResult vkfwSampleJoystick(int32_t jid, uint64_t timestamp, VkfwJoystickSample* pSample) {
+    int count;
+    uint32_t i;
+    
+    pSample[0].timestamp = timestamp;
+    
+    const float* axes = glfwGetJoystickAxes(jid, &count);
+    switch(glfwGetError(NULL)) {
+        case GLFW_NO_ERROR: break;
+        case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+        default: return VKFW_ERROR_UNKNOWN;
+    }
+    pSample[0].axesCount = (count < VKFW_JOYSTICK_SAMPLE_MAX_AXES) ? (uint32_t) count : VKFW_JOYSTICK_SAMPLE_MAX_AXES;
+    for(i = 0; i < pSample[0].axesCount; i++) pSample[0].axesStates[i] = axes[i];
+    
+    const unsigned char* buttons = glfwGetJoystickButtons(jid, &count);
+    switch(glfwGetError(NULL)) {
+        case GLFW_NO_ERROR: break;
+        case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+        default: return VKFW_ERROR_UNKNOWN;
+    }
+    pSample[0].buttonCount = (count < VKFW_JOYSTICK_SAMPLE_MAX_BUTTONS) ? (uint32_t) count : VKFW_JOYSTICK_SAMPLE_MAX_BUTTONS;
+    for(i = 0; i < pSample[0].buttonCount; i++) pSample[0].buttonStates[i] = buttons[i];
+    
+    const unsigned char* hats = glfwGetJoystickHats(jid, &count);
+    switch(glfwGetError(NULL)) {
+        case GLFW_NO_ERROR: break;
+        case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+        default: return VKFW_ERROR_UNKNOWN;
+    }
+    pSample[0].hatCount = (count < VKFW_JOYSTICK_SAMPLE_MAX_HATS) ? (uint32_t) count : VKFW_JOYSTICK_SAMPLE_MAX_HATS;
+    for(i = 0; i < pSample[0].hatCount; i++) pSample[0].hatStates[i] = hats[i];
+    
+    pSample[0].isGamepad = glfwGetGamepadState(jid, (GLFWgamepadstate*) &pSample[0].gamepadState) ? VKFW_TRUE : VKFW_FALSE;
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwBool32 vkfwAxisMoved(float lastReportedValue, float value) {
+    float distance = value - lastReportedValue;
+    if(distance < 0) distance = -distance;
+    return distance > joystickAxisChangeThreshold;
+}
+/* the gamepad buttons still pressed in the snapshot, before its gamepad state stops being compared */
+static void vkfwReleaseGamepadSnapshotButtons(int32_t jid, uint64_t timestamp) {
+    VkfwJoystickSample* pSnapshot = &joystickSnapshots[jid];
+    uint32_t i;
+    
+    if(!pSnapshot[0].isGamepad) return;
+    for(i = 0; i <= VKFW_GAMEPAD_BUTTON_LAST; i++) {
+        if(pSnapshot[0].gamepadState.buttons[i] != VKFW_ACTION_PRESS) continue;
+        pSnapshot[0].gamepadState.buttons[i] = VKFW_ACTION_RELEASE;
+        if(instanceCallbacks.gamepadButtonChange) VKFW_TRACED_CALLBACK("gamepadButtonChange", NULL, instanceCallbacks.gamepadButtonChange(jid, (VkfwGamepadButton) i, VKFW_ACTION_RELEASE, timestamp, instanceCallbacks.pUserData));
+        if(gamepadActionMapCount > 0) vkfwDispatchGamepadActions(jid, (VkfwGamepadButton) i, VKFW_ACTION_RELEASE);
+    }
+}
+/* all buttons still pressed in the snapshot, before it is invalidated or replaced, so that nothing stays held without a release */
+static void vkfwReleaseJoystickSnapshot(int32_t jid, uint64_t timestamp) {
+    VkfwJoystickSample* pSnapshot = &joystickSnapshots[jid];
+    uint32_t i;
+    
+    if(!joystickSnapshotValid[jid]) return;
+    for(i = 0; i < pSnapshot[0].buttonCount; i++) {
+        if(pSnapshot[0].buttonStates[i] != GLFW_PRESS) continue;
+        pSnapshot[0].buttonStates[i] = GLFW_RELEASE;
+        if(instanceCallbacks.joystickButtonChange) VKFW_TRACED_CALLBACK("joystickButtonChange", NULL, instanceCallbacks.joystickButtonChange(jid, i, VKFW_ACTION_RELEASE, timestamp, instanceCallbacks.pUserData));
+    }
+    vkfwReleaseGamepadSnapshotButtons(jid, timestamp);
+    joystickSnapshotValid[jid] = VKFW_FALSE;
+}
+static void vkfwDispatchJoystickChanges(int32_t jid, const VkfwJoystickSample* pSample) {
+    VkfwJoystickSample* pSnapshot = &joystickSnapshots[jid];
+    uint32_t i;
+    
+    /* the first sample after connection (or enabling) is just the baseline */
+    if(!joystickSnapshotValid[jid] || pSnapshot[0].axesCount != pSample[0].axesCount || pSnapshot[0].buttonCount != pSample[0].buttonCount || pSnapshot[0].hatCount != pSample[0].hatCount) {
+        vkfwReleaseJoystickSnapshot(jid, pSample[0].timestamp);
+        pSnapshot[0] = pSample[0];
+        joystickSnapshotValid[jid] = VKFW_TRUE;
+        return;
+    }
+    
+    for(i = 0; i < pSample[0].buttonCount; i++) {
+        if(pSample[0].buttonStates[i] == pSnapshot[0].buttonStates[i]) continue;
+        pSnapshot[0].buttonStates[i] = pSample[0].buttonStates[i];
+        if(instanceCallbacks.joystickButtonChange) VKFW_TRACED_CALLBACK("joystickButtonChange", NULL, instanceCallbacks.joystickButtonChange(jid, i, (VkfwAction) pSample[0].buttonStates[i], pSample[0].timestamp, instanceCallbacks.pUserData));
+    }
+    for(i = 0; i < pSample[0].hatCount; i++) {
+        if(pSample[0].hatStates[i] == pSnapshot[0].hatStates[i]) continue;
+        pSnapshot[0].hatStates[i] = pSample[0].hatStates[i];
+        if(instanceCallbacks.joystickHatChange) VKFW_TRACED_CALLBACK("joystickHatChange", NULL, instanceCallbacks.joystickHatChange(jid, i, (VkfwJoystickHatState) pSample[0].hatStates[i], pSample[0].timestamp, instanceCallbacks.pUserData));
+    }
+    for(i = 0; i < pSample[0].axesCount; i++) {
+        if(!vkfwAxisMoved(pSnapshot[0].axesStates[i], pSample[0].axesStates[i])) continue;
+        pSnapshot[0].axesStates[i] = pSample[0].axesStates[i];
+        if(instanceCallbacks.joystickAxisChange) VKFW_TRACED_CALLBACK("joystickAxisChange", NULL, instanceCallbacks.joystickAxisChange(jid, i, pSample[0].axesStates[i], pSample[0].timestamp, instanceCallbacks.pUserData));
+    }
+    
+    if(pSample[0].isGamepad && pSnapshot[0].isGamepad) {
+        for(i = 0; i <= VKFW_GAMEPAD_BUTTON_LAST; i++) {
+            if(pSample[0].gamepadState.buttons[i] == pSnapshot[0].gamepadState.buttons[i]) continue;
+            pSnapshot[0].gamepadState.buttons[i] = pSample[0].gamepadState.buttons[i];
+            if(instanceCallbacks.gamepadButtonChange) VKFW_TRACED_CALLBACK("gamepadButtonChange", NULL, instanceCallbacks.gamepadButtonChange(jid, (VkfwGamepadButton) i, (VkfwAction) pSample[0].gamepadState.buttons[i], pSample[0].timestamp, instanceCallbacks.pUserData));
+            if(gamepadActionMapCount > 0) vkfwDispatchGamepadActions(jid, (VkfwGamepadButton) i, (VkfwAction) pSample[0].gamepadState.buttons[i]);
+        }
+        for(i = 0; i <= VKFW_GAMEPAD_AXIS_LAST; i++) {
+            if(!vkfwAxisMoved(pSnapshot[0].gamepadState.axes[i], pSample[0].gamepadState.axes[i])) continue;
+            pSnapshot[0].gamepadState.axes[i] = pSample[0].gamepadState.axes[i];
+            if(instanceCallbacks.gamepadAxisChange) VKFW_TRACED_CALLBACK("gamepadAxisChange", NULL, instanceCallbacks.gamepadAxisChange(jid, (VkfwGamepadAxis) i, pSample[0].gamepadState.axes[i], pSample[0].timestamp, instanceCallbacks.pUserData));
+        }
+    } else {
+        /* a gamepad mapping was added or removed, so the new mapped state is the baseline */
+        vkfwReleaseGamepadSnapshotButtons(jid, pSample[0].timestamp);
+        pSnapshot[0].isGamepad = pSample[0].isGamepad;
+        pSnapshot[0].gamepadState = pSample[0].gamepadState;
+    }
+    pSnapshot[0].timestamp = pSample[0].timestamp;
+}
+static void vkfwStoreJoystickSample(atomic_uint_least32_t* pWords, const VkfwJoystickSample* pSample) {
+    uint32_t words[VKFW_JOYSTICK_SAMPLE_WORD_COUNT] = {0};
+    uint32_t i;
+    memcpy(words, pSample, sizeof(VkfwJoystickSample));
+    for(i = 0; i < VKFW_JOYSTICK_SAMPLE_WORD_COUNT; i++) atomic_store_explicit(&pWords[i], words[i], memory_order_relaxed);
+}
+static void vkfwLoadJoystickSample(atomic_uint_least32_t* pWords, VkfwJoystickSample* pSample) {
+    uint32_t words[VKFW_JOYSTICK_SAMPLE_WORD_COUNT];
+    uint32_t i;
+    for(i = 0; i < VKFW_JOYSTICK_SAMPLE_WORD_COUNT; i++) words[i] = (uint32_t) atomic_load_explicit(&pWords[i], memory_order_relaxed);
+    memcpy(pSample, words, sizeof(VkfwJoystickSample));
+}
+static void vkfwPushJoystickSample(VkfwJoystickSampleRing* pRing, const VkfwJoystickSample* pSample) {
+    uint32_t head = atomic_load_explicit(&pRing[0].head, memory_order_relaxed);
+    if(!pRing[0].connected) {
+        atomic_store_explicit(&pRing[0].first, head, memory_order_relaxed); /* published by the release of head below */
+        pRing[0].connected = VKFW_TRUE;
+    }
+    atomic_store_explicit(&pRing[0].writing, head + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release); /* the claim is visible before any write to the slot */
+    vkfwStoreJoystickSample(pRing[0].sampleWords[head % VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH], pSample);
+    atomic_store_explicit(&pRing[0].head, head + 1, memory_order_release);
+}
+/* reads all present joysticks, recording the samples in the rings if requested, and generates the input callbacks if enabled */
+static VkfwResult vkfwPollJoysticks(uint64_t now, VkfwBool32 recordSamples) {
+    int jid;
+    VkfwJoystickSample sample;
+    
+    for(jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; jid++) {
+        int present = glfwJoystickPresent(jid);
+        switch(glfwGetError(NULL)) {
+            case GLFW_NO_ERROR: break;
+            case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+            default: return VKFW_ERROR_UNKNOWN;
+        }
+        if(!present) {
+            if(joystickEventsEnabled) vkfwReleaseJoystickSnapshot(jid, now);
+            joystickSnapshotValid[jid] = VKFW_FALSE;
+            joystickSampleRings[jid].connected = VKFW_FALSE;
+            continue;
+        }
+        
+        VkfwResult result = vkfwSampleJoystick(jid, now, &sample);
+        if(result) return result;
+        if(recordSamples) vkfwPushJoystickSample(&joystickSampleRings[jid], &sample);
+        if(joystickEventsEnabled) vkfwDispatchJoystickChanges(jid, &sample);
+    }
+    
+    return VKFW_SUCCESS;
+}
+/* internal timers: things VKFW does periodically while processing events, independent of platform events. */
+static uint64_t vkfwGetNextTimerDeadline(void) {
+    VkfwWindow window;
+    uint64_t nextDeadline = UINT64_MAX;
+    if(joystickSamplingPeriod != 0 && joystickNextSampleTime < nextDeadline) nextDeadline = joystickNextSampleTime;
+    if(animatedCursorWindowCount > 0) {
+        for(window = windowList; window != NULL; window = window[0].nextWindow) {
+            if(window[0].activeCursor == NULL || window[0].activeCursor[0].frameCount <= 1) continue;
+            if(window[0].nextCursorFrameTime < nextDeadline) nextDeadline = window[0].nextCursorFrameTime;
+        }
+    }
+    if(pendingFramebufferSettleCount > 0) {
+        for(window = windowList; window != NULL; window = window[0].nextWindow) {
+            if(window[0].framebufferSettlePending && window[0].framebufferSettleTime < nextDeadline) nextDeadline = window[0].framebufferSettleTime;
+        }
+    }
+    return nextDeadline;
+}
+static VkfwResult vkfwProcessTimers(uint64_t now) {
+    VkfwWindow window, nextWindow;
+    uint64_t elapsedFrames;
+    
+    if(joystickSamplingPeriod != 0 && now >= joystickNextSampleTime) {
+        VkfwResult result = vkfwPollJoysticks(now, VKFW_TRUE);
+        if(result) return result;
+        joystickNextSampleTime += joystickSamplingPeriod;
+        if(joystickNextSampleTime <= now) joystickNextSampleTime = now + joystickSamplingPeriod; /* we fell behind, don't try to catch up with a burst of samples */
+    }
+    /* cursor animations skip the frames they fell behind on, so that they keep their speed */
+    if(animatedCursorWindowCount > 0) {
+        for(window = windowList; window != NULL; window = window[0].nextWindow) {
+            if(window[0].activeCursor == NULL || window[0].activeCursor[0].frameCount <= 1 || now < window[0].nextCursorFrameTime) continue;
+            elapsedFrames = (now - window[0].nextCursorFrameTime) / window[0].activeCursor[0].frameDuration + 1;
+            window[0].activeCursorFrame     = (uint32_t) ((window[0].activeCursorFrame + elapsedFrames) % window[0].activeCursor[0].frameCount);
+            window[0].nextCursorFrameTime  += elapsedFrames * window[0].activeCursor[0].frameDuration;
+            glfwSetCursor(window[0].windowHandle, window[0].activeCursorFrames[window[0].activeCursorFrame]);
+            switch(glfwGetError(NULL)) {
+                case GLFW_NO_ERROR: break;
+                case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+                default: return VKFW_ERROR_UNKNOWN;
+            }
+        }
+    }
+    /* a resize that ends at the size it started from doesn't count as a change */
+    if(pendingFramebufferSettleCount > 0) {
+        /* the callback may destroy any window, so the list is walked again from its head after each one */
+        for(window = windowList; window != NULL && pendingFramebufferSettleCount > 0; window = nextWindow) {
+            nextWindow = window[0].nextWindow;
+            if(!window[0].framebufferSettlePending || now < window[0].framebufferSettleTime) continue;
+            window[0].framebufferSettlePending = VKFW_FALSE;
+            pendingFramebufferSettleCount--;
+            if(window[0].pendingFramebufferExtent.width  == atomic_load(&window[0].settledFramebufferWidth) &&
+               window[0].pendingFramebufferExtent.height == atomic_load(&window[0].settledFramebufferHeight)) continue;
+            vkfwPublishFramebufferExtent(window, window[0].pendingFramebufferExtent);
+            timerEventCount++;
+            if(window[0].callbacks.framebufferExtentSettled != NULL) {
+                VKFW_TRACED_CALLBACK("framebufferExtentSettled", window,
+                    window[0].callbacks.framebufferExtentSettled(window, window[0].pendingFramebufferExtent, atomic_load(&window[0].settledFramebufferSequence) / 2, window[0].callbacks.pUserData));
+                nextWindow = windowList;
+            }
+        }
+    }
+    return VKFW_SUCCESS;
+}
+/* GLFW reads CLOCK_MONOTONIC on Linux, in nanoseconds. as that isn't part of its API, the clocks are compared once instead of assuming it. */
+static VkfwBool32 vkfwIsTimerMonotonicClock(void) {
+#if defined(VKFW_MONOTONIC_TIMESTAMP)
+    struct timespec clockValue;
+    if(timerFrequency != 1000000000) return VKFW_FALSE;
+    if(clock_gettime(CLOCK_MONOTONIC, &clockValue) != 0) return VKFW_FALSE;
+    uint64_t timerValue = glfwGetTimerValue();
+    uint64_t clockNanoseconds = (uint64_t) clockValue.tv_sec * 1000000000 + (uint64_t) clockValue.tv_nsec;
+    uint64_t difference = (timerValue > clockNanoseconds) ? timerValue - clockNanoseconds : clockNanoseconds - timerValue;
+    return (difference < 1000000) ? VKFW_TRUE : VKFW_FALSE;
+#else
+    return VKFW_FALSE;
+#endif
+}
+#if defined(VKFW_TIMESTAMP_COUNTER)
+/* only a counter which runs at a constant rate in all power states can be used as a clock, which is what CPUID calls invariant */
+static VkfwBool32 vkfwHasInvariantTimestampCounter(void) {
+#if defined(_MSC_VER)
+    int registers[4];
+    __cpuid(registers, 0x80000000);
+    if((unsigned int) registers[0] < 0x80000007) return VKFW_FALSE;
+    __cpuid(registers, 0x80000007);
+    return (registers[3] & (1 << 8)) ? VKFW_TRUE : VKFW_FALSE;
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if(!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return VKFW_FALSE;
+    return (edx & (1U << 8)) ? VKFW_TRUE : VKFW_FALSE;
+#endif
+}
+/* measures the counter against the GLFW timer for 10 ms, busy waiting since a sleep could end arbitrarily late */
+static uint64_t vkfwCalibrateTimestampCounter(void) {
+    uint64_t timerStart = glfwGetTimerValue();
+    uint64_t counterStart = __rdtsc();
+    uint64_t timerEnd, counterEnd;
+    do {
+        timerEnd = glfwGetTimerValue();
+    } while(timerEnd - timerStart < timerFrequency / 100);
+    counterEnd = __rdtsc();
+    return (uint64_t) ((double) (counterEnd - counterStart) * (double) timerFrequency / (double) (timerEnd - timerStart));
+}
+#endif
+static uint64_t vkfwGetDeadlineFromTimeout(double timeout) {
+    uint64_t now = glfwGetTimerValue();
+    double timeoutTicks = timeout * (double) timerFrequency;
+    if(timeoutTicks >= (double) (UINT64_MAX - now)) return UINT64_MAX;
+    return now + (uint64_t) timeoutTicks;
+}
+#if defined(VKFW_PRECISE_WAIT)
+/* the last part of a timed wait is slept without watching for events, events arriving meanwhile are delayed by at most this long */
+#define VKFW_PRECISE_WAIT_MARGIN (timerFrequency / 1000)
+
+/* sleeps for the given timer ticks on the monotonic clock. the sleep is absolute, so that being interrupted doesn't make it drift. */
+static void vkfwSleepPrecisely(uint64_t ticks) {
+    struct timespec wakeup;
+    uint64_t nanoseconds = (ticks * 1000000000 + timerFrequency - 1) / timerFrequency; /* rounded up, a sleep which ends early would need another round */
+    
+    clock_gettime(CLOCK_MONOTONIC, &wakeup);
+    wakeup.tv_sec  += (time_t) (nanoseconds / 1000000000);
+    wakeup.tv_nsec += (long) (nanoseconds % 1000000000);
+    if(wakeup.tv_nsec >= 1000000000) {
+        wakeup.tv_sec  += 1;
+        wakeup.tv_nsec -= 1000000000;
+    }
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, NULL) == EINTR) {}
+}
+#else
+#define VKFW_PRECISE_WAIT_MARGIN 0
+#endif
+/* waits for events until the deadline (UINT64_MAX meaning indefinitely), but wakes up in between to run the internal timers.
+   GLFW doesn't tell us whether an event arrived, so a wait that ends before its timeout is taken as one.
+   events the timers generate for the application, like a settled resize, end the wait as well. */
+static VkfwResult vkfwWaitEventsUntilDeadline(uint64_t deadline) {
+    VkfwResult result;
+    uint64_t now = glfwGetTimerValue();
+    uint64_t previousTimerEventCount;
+    uint64_t waitEnd; /* the time the platform wait would have timed out at */
+    VkfwBool32 polled = VKFW_FALSE;
+    
+    if(allocationTrackingEnabled) vkfwBeginAllocationFrame();
+    vkfwRewindScratch();
+    
+    for(;;) {
+        previousTimerEventCount = timerEventCount;
+        result = vkfwProcessTimers(now);
+        if(result) return result;
+        if(polled && timerEventCount != previousTimerEventCount) break;
+        
+        uint64_t wakeupTime = vkfwGetNextTimerDeadline();
+        if(deadline < wakeupTime) wakeupTime = deadline;
+        
+        if(now >= wakeupTime) {
+            waitEnd = now;
+            glfwPollEvents();
+        } else if(wakeupTime == UINT64_MAX) {
+            waitEnd = UINT64_MAX;
+            glfwWaitEvents();
+        } else if(wakeupTime - now > VKFW_PRECISE_WAIT_MARGIN) {
+            waitEnd = wakeupTime - VKFW_PRECISE_WAIT_MARGIN;
+            glfwWaitEventsTimeout((double) (waitEnd - now) / (double) timerFrequency);
+        } else {
+            waitEnd = now;
+#if defined(VKFW_PRECISE_WAIT)
+            vkfwSleepPrecisely(wakeupTime - now);
+#endif
+            glfwPollEvents();
+        }
+        switch(glfwGetError(NULL)) {
+            case GLFW_NO_ERROR: break;
+            case GLFW_INVALID_VALUE: return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+            case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+            default: return VKFW_ERROR_UNKNOWN;
+        }
+        
+        polled = VKFW_TRUE;
+        
+        uint64_t previousNow = now;
+        now = glfwGetTimerValue();
+        if(previousNow >= wakeupTime || now < waitEnd || now >= deadline) break;
+    }
+    
+    vkfwUpdateCursorVariants();
+    vkfwFlushTextInput();
+    
+    result = vkfwProcessTimers(now);
+    if(result) return result;
+    
+    /* without sampling, the joystick input callbacks are generated once per event processing */
+    if(joystickEventsEnabled && joystickSamplingPeriod == 0) return vkfwPollJoysticks(now, VKFW_FALSE);
+    
+    return VKFW_SUCCESS;
+}
+static void vkfwLockPresentationSupportCache(void) {
+    while(atomic_flag_test_and_set_explicit(&presentationSupportCacheLock, memory_order_acquire)) VKFW_SPIN_PAUSE();
+}
+static void vkfwUnlockPresentationSupportCache(void) {
+    atomic_flag_clear_explicit(&presentationSupportCacheLock, memory_order_release);
+}
+static void vkfwClearPresentationSupportCache(void) {
+    uint32_t i;
+    vkfwLockPresentationSupportCache();
+    for(i = 0; i < VKFW_PRESENTATION_SUPPORT_CACHE_SIZE; i++) {
+        presentationSupportCache[i].instance        = VK_NULL_HANDLE;
+        presentationSupportCache[i].physicalDevice  = VK_NULL_HANDLE;
+        presentationSupportCache[i].queriedFamilies     = 0;
+        presentationSupportCache[i].supportedFamilies   = 0;
+    }
+    presentationSupportCacheNextEviction = 0;
+    vkfwUnlockPresentationSupportCache();
+}
+/* removes the cached answers for one VkInstance, before it is destroyed */
+static void vkfwForgetPresentationSupport(VkInstance instance) {
+    uint32_t i;
+    vkfwLockPresentationSupportCache();
+    for(i = 0; i < VKFW_PRESENTATION_SUPPORT_CACHE_SIZE; i++) {
+        if(presentationSupportCache[i].instance != instance) continue;
+        presentationSupportCache[i].instance        = VK_NULL_HANDLE;
+        presentationSupportCache[i].physicalDevice  = VK_NULL_HANDLE;
+        presentationSupportCache[i].queriedFamilies     = 0;
+        presentationSupportCache[i].supportedFamilies   = 0;
+    }
+    vkfwUnlockPresentationSupportCache();
+}
+static const VkfwVulkanInstanceFunctions* vkfwFindVulkanInstanceFunctions(VkInstance instance) {
+    uint32_t i;
+    if(instance == VK_NULL_HANDLE) return NULL; /* the unused tables */
+    for(i = 0; i < VKFW_VULKAN_INSTANCE_FUNCTION_TABLE_COUNT; i++) {
+        if(vulkanInstanceFunctions[i].instance == instance) return &vulkanInstanceFunctions[i];
+    }
+    return NULL;
+}
+/* queries the platform, through the loaded functions where possible */
+static VkfwVkBool32 vkfwQueryPresentationSupport(VkInstance instance, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) {
+    const VkfwVulkanInstanceFunctions* pFunctions = vkfwFindVulkanInstanceFunctions(instance);
+    if(pFunctions != NULL) {
+        switch(glfwGetPlatform()) {
+#if defined(VKFW_EXPOSE_NATIVE_WIN32)
+            case GLFW_PLATFORM_WIN32:
+                if(pFunctions[0].vkGetPhysicalDeviceWin32PresentationSupportKHR != NULL) {
+                    return pFunctions[0].vkGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
+                }
+            break;
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_WAYLAND)
+            case GLFW_PLATFORM_WAYLAND:
+                if(pFunctions[0].vkGetPhysicalDeviceWaylandPresentationSupportKHR != NULL) {
+                    return pFunctions[0].vkGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, glfwGetWaylandDisplay());
+                }
+            break;
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_X11)
+            case GLFW_PLATFORM_X11: {
+                /* GLFW checks the default visual of the default screen as well */
+                Display* display = glfwGetX11Display();
+                VisualID visualID = XVisualIDFromVisual(DefaultVisual(display, DefaultScreen(display)));
+                if(pFunctions[0].vkGetPhysicalDeviceXcbPresentationSupportKHR != NULL) {
+                    return pFunctions[0].vkGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, XGetXCBConnection(display), (xcb_visualid_t) visualID);
+                }
+                if(pFunctions[0].vkGetPhysicalDeviceXlibPresentationSupportKHR != NULL) {
+                    return pFunctions[0].vkGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, display, visualID);
+                }
+            } break;
+#endif
+            default: break;
+        }
+    }
+    VkfwVkBool32 supported;
+    supported = glfwGetPhysicalDevicePresentationSupport(instance, physicalDevice, queueFamilyIndex);
+    return supported;
+}
+/* creates the surface through the loaded functions of the VkInstance if there are any, pFunctions may be NULL */
+static VkResult vkfwCreateSurface(const VkfwVulkanInstanceFunctions* pFunctions, VkInstance instance, VkfwWindow window, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    if(pFunctions != NULL) {
+        switch(glfwGetPlatform()) {
+#if defined(VKFW_EXPOSE_NATIVE_WIN32)
+            case GLFW_PLATFORM_WIN32:
+                if(pFunctions[0].vkCreateWin32SurfaceKHR != NULL) {
+                    VkWin32SurfaceCreateInfoKHR createInfo = {VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR};
+                    createInfo.hinstance = GetModuleHandleW(NULL);
+                    createInfo.hwnd = glfwGetWin32Window(window[0].windowHandle);
+                    return pFunctions[0].vkCreateWin32SurfaceKHR(instance, &createInfo, pAllocator, pSurface);
+                }
+            break;
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_WAYLAND)
+            case GLFW_PLATFORM_WAYLAND:
+                if(pFunctions[0].vkCreateWaylandSurfaceKHR != NULL) {
+                    VkWaylandSurfaceCreateInfoKHR createInfo = {VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR};
+                    createInfo.display = glfwGetWaylandDisplay();
+                    createInfo.surface = glfwGetWaylandWindow(window[0].windowHandle);
+                    return pFunctions[0].vkCreateWaylandSurfaceKHR(instance, &createInfo, pAllocator, pSurface);
+                }
+            break;
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_X11)
+            case GLFW_PLATFORM_X11:
+                if(pFunctions[0].vkCreateXcbSurfaceKHR != NULL) {
+                    VkXcbSurfaceCreateInfoKHR createInfo = {VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR};
+                    createInfo.connection = XGetXCBConnection(glfwGetX11Display());
+                    createInfo.window = (xcb_window_t) glfwGetX11Window(window[0].windowHandle);
+                    return pFunctions[0].vkCreateXcbSurfaceKHR(instance, &createInfo, pAllocator, pSurface);
+                }
+                if(pFunctions[0].vkCreateXlibSurfaceKHR != NULL) {
+                    VkXlibSurfaceCreateInfoKHR createInfo = {VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR};
+                    createInfo.dpy = glfwGetX11Display();
+                    createInfo.window = glfwGetX11Window(window[0].windowHandle);
+                    return pFunctions[0].vkCreateXlibSurfaceKHR(instance, &createInfo, pAllocator, pSurface);
+                }
+            break;
+#endif
+            default: break;
+        }
+    }
+    VkResult result;
+    result = glfwCreateWindowSurface(instance, window[0].windowHandle, pAllocator, pSurface);
+    return result;
+}
+/* returns the cached or freshly queried presentation support. the GLFW error of a query is returned in pGLFWError, and failed queries are not cached. */
+static VkfwVkBool32 vkfwGetPresentationSupport(VkfwVkInstance instance, VkfwVkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, int* pGLFWError) {
+    uint32_t i;
+    uint64_t familyBit;
+    VkfwVkBool32 supported;
+    VkfwPresentationSupportCacheEntry* pEntry = NULL;
+    
+    pGLFWError[0] = GLFW_NO_ERROR;
+    if(queueFamilyIndex >= VKFW_PRESENTATION_SUPPORT_CACHED_FAMILIES || vkfwFindVulkanInstanceFunctions(instance) == NULL) {
+        supported = vkfwQueryPresentationSupport(instance, physicalDevice, queueFamilyIndex);
+        pGLFWError[0] = glfwGetError(NULL);
+        return supported;
+    }
+    familyBit = (uint64_t) 1 << queueFamilyIndex;
+    
+    vkfwLockPresentationSupportCache();
+    for(i = 0; i < VKFW_PRESENTATION_SUPPORT_CACHE_SIZE; i++) {
+        if(presentationSupportCache[i].physicalDevice == physicalDevice && presentationSupportCache[i].instance == instance) {
+            pEntry = &presentationSupportCache[i];
+            break;
+        }
+    }
+    if(pEntry != NULL && (pEntry[0].queriedFamilies & familyBit)) {
+        supported = (pEntry[0].supportedFamilies & familyBit) ? VK_TRUE : VK_FALSE;
+        vkfwUnlockPresentationSupportCache();
+        return supported;
+    }
+    vkfwUnlockPresentationSupportCache();
+    
+    supported = vkfwQueryPresentationSupport(instance, physicalDevice, queueFamilyIndex);
+    pGLFWError[0] = glfwGetError(NULL);
+    if(pGLFWError[0] != GLFW_NO_ERROR) return supported;
+    
+    /* the entry may have been evicted by another thread in between, so look it up again */
+    vkfwLockPresentationSupportCache();
+    pEntry = NULL;
+    for(i = 0; i < VKFW_PRESENTATION_SUPPORT_CACHE_SIZE; i++) {
+        if(presentationSupportCache[i].physicalDevice == physicalDevice && presentationSupportCache[i].instance == instance) {
+            pEntry = &presentationSupportCache[i];
+            break;
+        }
+    }
+    if(pEntry == NULL) {
+        for(i = 0; i < VKFW_PRESENTATION_SUPPORT_CACHE_SIZE; i++) {
+            if(presentationSupportCache[i].physicalDevice == VK_NULL_HANDLE) {
+                pEntry = &presentationSupportCache[i];
+                break;
+            }
+        }
+        if(pEntry == NULL) {
+            pEntry = &presentationSupportCache[presentationSupportCacheNextEviction];
+            presentationSupportCacheNextEviction = (presentationSupportCacheNextEviction + 1) % VKFW_PRESENTATION_SUPPORT_CACHE_SIZE;
+        }
+        pEntry[0].instance          = instance;
+        pEntry[0].physicalDevice    = physicalDevice;
+        pEntry[0].queriedFamilies   = 0;
+        pEntry[0].supportedFamilies = 0;
+    }
+    pEntry[0].queriedFamilies |= familyBit;
+    if(supported) pEntry[0].supportedFamilies |= familyBit;
+    vkfwUnlockPresentationSupportCache();
+    
+    return supported;
+}
+static VkfwResult vkfwEnumerateGlobalPropertiesUntimed(VkfwGlobalProperties* pProperties) {
     if(pProperties == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     pProperties[0].majorVersion                = VKFW_VERSION_MAJOR;
     pProperties[0].minorVersion                = VKFW_VERSION_MINOR;
@@ -40,28 +1965,44 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateGlobalProperties(VkfwGlobalP
     return VKFW_SUCCESS;
 }
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateInstance(const VkfwInstanceCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwInstance* pInstance) {    
+    int jid;
+    
     if(vfkwInstanceInitialized) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* multiple Instances currently not supported because GLFW has only one initialization state */
     
     if(pCreateInfo == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     if(pInstance == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
+    if(pCreateInfo[0].sType != VKFW_STRUCTURE_TYPE_INSTANCE_CREATE_INFO)    return VKFW_ERROR_INVALID_ENUM_VALUE;
+    if(pCreateInfo[0].pNext != NULL)                                        return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+    if(!(pCreateInfo[0].joystickAxisChangeThreshold >= 0))                  return VKFW_ERROR_INVALID_NUMERIC_VALUE; /* also catches NaN */
+    if(pAllocator != NULL) {
+        if((pAllocator[0].pfnAllocation == NULL) || (pAllocator[0].pfnReallocation == NULL) || (pAllocator[0].pfnFree == NULL)) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    }
+    
+    /* only now, so that a rejected create info doesn't leave an allocator or the tracking to the allocations without an instance */
     initAllocator = pAllocator;
+    allocationTrackingEnabled = (pCreateInfo[0].flags & VKFW_INSTANCE_CREATE_ENABLE_ALLOCATION_TRACKING_BIT) ? VKFW_TRUE : VKFW_FALSE;
     
-    if(pAllocator == NULL) {
+    if(pAllocator == NULL && !allocationTrackingEnabled) {
         glfwInitAllocator(NULL);
     } else {
-        ourGLFWAllocator.allocate   = pAllocator[0].pfnAllocation;
-        ourGLFWAllocator.reallocate = pAllocator[0].pfnReallocation;
-        ourGLFWAllocator.deallocate = pAllocator[0].pfnFree;
-        ourGLFWAllocator.user       = pAllocator[0].pUserData;
-        if((ourGLFWAllocator.allocate == NULL) || (ourGLFWAllocator.reallocate == NULL) || (ourGLFWAllocator.deallocate == NULL)) return VKFW_ERROR_INVALID_POINTER_VALUE;
-        glfwInitAllocator(&ourGLFWAllocator);
+        if(pAllocator != NULL) {
+            ourGLFWAllocator.allocate   = pAllocator[0].pfnAllocation;
+            ourGLFWAllocator.reallocate = pAllocator[0].pfnReallocation;
+            ourGLFWAllocator.deallocate = pAllocator[0].pfnFree;
+            ourGLFWAllocator.user       = pAllocator[0].pUserData;
+        }
+        if(allocationTrackingEnabled) {
+            vkfwInitAllocationTracking();
+            trackingGLFWAllocator.allocate      = vkfwAllocateForGLFW;
+            trackingGLFWAllocator.reallocate    = vkfwReallocateForGLFW;
+            trackingGLFWAllocator.deallocate    = vkfwFreeForGLFW;
+            trackingGLFWAllocator.user          = NULL;
+            glfwInitAllocator(&trackingGLFWAllocator);
+        } else glfwInitAllocator(&ourGLFWAllocator);
     }
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
     
-    if(pCreateInfo[0].sType != VKFW_STRUCTURE_TYPE_INSTANCE_CREATE_INFO)    return VKFW_ERROR_INVALID_ENUM_VALUE;
-    if(pCreateInfo[0].pNext != NULL)                                        return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
-    
     if(pCreateInfo[0].flags & VKFW_INSTANCE_CREATE_DISABLE_JOYSTICK_HAT_BUTTONS_BIT) {
         glfwInitHint(GLFW_JOYSTICK_HAT_BUTTONS, GLFW_FALSE);
     } else {
@@ -106,6 +2047,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateInstance(const VkfwInstanceCrea
     
     glfwInitVulkanLoader(pCreateInfo[0].desiredVulkanLoader);
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    desiredVulkanLoader = pCreateInfo[0].desiredVulkanLoader;
     
     int initCode = glfwInit();
     
@@ -117,20 +2059,48 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateInstance(const VkfwInstanceCrea
         }
     }
     
-    glfwSetMonitorCallback((GLFWmonitorfun) pCreateInfo[0].callbacks.monitorConnection);
+    glfwSetMonitorCallback((pCreateInfo[0].callbacks.monitorConnection != NULL) ? vkfwMonitorConnectionTrampoline : NULL);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetJoystickCallback(vkfwJoystickConnectionTrampoline);
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetJoystickCallback((GLFWjoystickfun) pCreateInfo[0].callbacks.joystickConnection);
+    
+    instanceCallbacks = pCreateInfo[0].callbacks;
+    joystickAxisChangeThreshold = pCreateInfo[0].joystickAxisChangeThreshold;
+    joystickCallbacksEnabled = (instanceCallbacks.joystickButtonChange || instanceCallbacks.joystickHatChange || instanceCallbacks.joystickAxisChange
+                                || instanceCallbacks.gamepadButtonChange || instanceCallbacks.gamepadAxisChange) ? VKFW_TRUE : VKFW_FALSE;
+    joystickEventsEnabled = joystickCallbacksEnabled;
+    for(jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; jid++) joystickSnapshotValid[jid] = VKFW_FALSE;
+    
+    timerFrequency = glfwGetTimerFrequency();
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
     
+    timestampSource = VKFW_TIMESTAMP_SOURCE_TIMER;
+    timestampFrequency = timerFrequency;
+    timestampFromMonotonicClock = vkfwIsTimerMonotonicClock();
+    
+    atomic_fetch_add(&instrumentationGeneration, 1);
+    VkfwBool32 statistics = (pCreateInfo[0].flags & VKFW_INSTANCE_CREATE_ENABLE_STATISTICS_BIT) ? VKFW_TRUE : VKFW_FALSE;
+    VkfwBool32 trace = (pCreateInfo[0].flags & VKFW_INSTANCE_CREATE_ENABLE_TRACE_BIT) ? VKFW_TRUE : VKFW_FALSE;
+    atomic_store(&statisticsEnabled, statistics);
+    atomic_store(&traceEnabled, trace);
+    atomic_store(&instrumentationEnabled, (statistics || trace) ? VKFW_TRUE : VKFW_FALSE);
+    atomic_store(&entryPointTrackingEnabled, (statistics || trace || allocationTrackingEnabled) ? VKFW_TRUE : VKFW_FALSE); /* the allocation tracking needs the current entry point */
+    
     vfkwInstanceInitialized = VKFW_TRUE;
     pInstance[0] = (VkfwInstance) &instanceHandleAddress;
     return VKFW_SUCCESS;
 }
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyInstance(VkfwInstance instance, const VkfwAllocationCallbacks* pAllocator) {
+    uint32_t i;
+    VkfwWindow nextWindow;
+    
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pAllocator != initAllocator) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
+    /* first, so that the calls still recording on other threads finish before the timestamp source and GLFW go away */
+    vkfwFreeInstrumentation();
+    
     glfwTerminate();
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR:             break;
@@ -138,11 +2108,51 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyInstance(VkfwInstance instance
         default: return VKFW_ERROR_UNKNOWN;
     }
     
+    joystickSamplingPeriod = 0;
+    for(i = GLFW_JOYSTICK_1; i <= GLFW_JOYSTICK_LAST; i++) joystickSampleRings[i].connected = VKFW_FALSE;
+    vkfwFreeScratch();
+    keyTablesValid = VKFW_FALSE;
+    
+    /* glfwTerminate destroyed the underlying cursors and windows already */
+    for(i = 0; i < VKFW_STANDARD_CURSOR_SHAPE_COUNT; i++) {
+        vkfwFree(standardCursorCache[i]); /* always from the allocator of the instance */
+        standardCursorCache[i] = NULL;
+    }
+    while(actionMapList != NULL) {
+        VkfwActionMap nextActionMap = actionMapList[0].nextActionMap;
+        VkfwAllocationCallbacks actionMapAllocator = actionMapList[0].allocator;
+        vkfwFreeWith(vkfwGetObjectAllocator(&actionMapAllocator), actionMapList);
+        actionMapList = nextActionMap;
+    }
+    gamepadActionMapCount = 0;
+    while(windowList != NULL) {
+        nextWindow = windowList[0].nextWindow;
+        VkfwAllocationCallbacks windowAllocator = windowList[0].allocator;
+        vkfwFreeWith(vkfwGetObjectAllocator(&windowAllocator), windowList);
+        windowList = nextWindow;
+    }
+    animatedCursorWindowCount = 0;
+    pendingFramebufferSettleCount = 0;
+    pendingTextInputWindowCount = 0;
+    pendingCursorVariantWindowCount = 0;
+    
+    /* the application may create a new VkInstance with the same handle value for the next instance */
+    vkfwClearPresentationSupportCache();
+    memset(vulkanInstanceFunctions, 0, sizeof(vulkanInstanceFunctions));
+    desiredVulkanLoader = NULL;
+    
+    timestampSource = VKFW_TIMESTAMP_SOURCE_TIMER;
+    timestampFrequency = 0;
+    timestampFromMonotonicClock = VKFW_FALSE;
+    
+    atomic_store(&entryPointTrackingEnabled, VKFW_FALSE);
+    allocationTrackingEnabled = VKFW_FALSE;
+    
     initAllocator = NULL;
     vfkwInstanceInitialized = VKFW_FALSE;
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateInstanceProperties(VkfwInstance instance, VkfwInstanceProperties* pProperties) {
+static VkfwResult vkfwEnumerateInstancePropertiesUntimed(VkfwInstance instance, VkfwInstanceProperties* pProperties) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pProperties == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
@@ -178,11 +2188,17 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateInstanceProperties(VkfwInsta
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyScancode(VkfwInstance instance, VkfwKey key, int32_t* pScancode) {
+static VkfwResult vkfwGetKeyScancodeUntimed(VkfwInstance instance, VkfwKey key, int32_t* pScancode) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pScancode == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
+    if(key >= VKFW_KEY_SPACE && key <= VKFW_KEY_LAST) {
+        if(!keyTablesValid) vkfwBuildKeyTables();
+        pScancode[0] = keyScancodes[key];
+        return VKFW_SUCCESS;
+    }
+    
     pScancode[0] = glfwGetKeyScancode(key);
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
@@ -192,12 +2208,25 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyScancode(VkfwInstance instance,
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyName(VkfwInstance instance, VkfwKey key, int32_t scancode, const char** pKeyName) {
+static VkfwResult vkfwGetKeyNameUntimed(VkfwInstance instance, VkfwKey key, int32_t scancode, const char** pKeyName) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pKeyName == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
-    pKeyName[0] = glfwGetKeyName(key, scancode);
+    /* the tables only change when the strings would be invalidated anyway, so they are returned directly */
+    if(key >= VKFW_KEY_SPACE && key <= VKFW_KEY_LAST) {
+        if(!keyTablesValid) vkfwBuildKeyTables();
+        pKeyName[0] = (keyNames[key][0] != '\0') ? keyNames[key] : NULL;
+        return VKFW_SUCCESS;
+    }
+    if(key == VKFW_KEY_UNKNOWN && scancode >= 0 && scancode < VKFW_KEY_TABLE_SCANCODE_COUNT) {
+        if(!keyTablesValid) vkfwBuildKeyTables();
+        if(!scancodeValid[scancode]) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+        pKeyName[0] = (scancodeNames[scancode][0] != '\0') ? scancodeNames[scancode] : NULL;
+        return VKFW_SUCCESS;
+    }
+    
+    const char* keyName = glfwGetKeyName(key, scancode);
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
         case GLFW_INVALID_VALUE: return VKFW_ERROR_INVALID_NUMERIC_VALUE;
@@ -206,9 +2235,29 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyName(VkfwInstance instance, Vkf
         default: return VKFW_ERROR_UNKNOWN;
     }
     
+    return vkfwCopyStringToScratch(keyName, pKeyName);
+}
+static VkfwResult vkfwGetKeyNamesUntimed(VkfwInstance instance, uint32_t keyCount, const VkfwKey* pKeys, const char** pKeyNames) {
+    uint32_t i;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(keyCount == 0) return VKFW_SUCCESS;
+    if(pKeys == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pKeyNames == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    for(i = 0; i < keyCount; i++) {
+        if(pKeys[i] != VKFW_KEY_UNKNOWN && (pKeys[i] < VKFW_KEY_SPACE || pKeys[i] > VKFW_KEY_LAST)) return VKFW_ERROR_INVALID_ENUM_VALUE;
+    }
+    
+    if(!keyTablesValid) vkfwBuildKeyTables();
+    for(i = 0; i < keyCount; i++) {
+        pKeyNames[i] = (pKeys[i] != VKFW_KEY_UNKNOWN && keyNames[pKeys[i]][0] != '\0') ? keyNames[pKeys[i]] : NULL;
+    }
+    
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwPostEmptyEvent(VkfwInstance instance) {
+static VkfwResult vkfwPostEmptyEventUntimed(VkfwInstance instance) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     
@@ -222,34 +2271,81 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwPostEmptyEvent(VkfwInstance instance)
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwProcessEvents(VkfwInstance instance, double timeout, VkfwBool32 waitIndefinitely) {
+static VkfwResult vkfwProcessEventsUntimed(VkfwInstance instance, double timeout, VkfwBool32 waitIndefinitely) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     
+    uint64_t deadline;
     switch(waitIndefinitely) {
-        case VKFW_TRUE: glfwWaitEvents(); break;
+        case VKFW_TRUE: deadline = UINT64_MAX; break;
         case VKFW_FALSE:
-            if(timeout == 0) glfwPollEvents();
-            else glfwWaitEventsTimeout(timeout); 
+            if(!(timeout >= 0)) return VKFW_ERROR_INVALID_NUMERIC_VALUE; /* also catches NaN, like GLFW does */
+            deadline = vkfwGetDeadlineFromTimeout(timeout);
         break;
         default: return VKFW_ERROR_INVALID_ENUM_VALUE;
     }
     
+    return vkfwWaitEventsUntilDeadline(deadline);
+}
+static VkfwResult vkfwWaitEventsUntilUntimed(VkfwInstance instance, uint64_t deadline) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    
+    return vkfwWaitEventsUntilDeadline(deadline);
+}
+/* GLFW drains the platform event queue in one go, which can't be interrupted, so the budget limits what VKFW does on top of it:
+   the internal timers and the joystick polling are left for the next event processing once the budget is spent. */
+static VkfwResult vkfwProcessEventsBudgetedUntimed(VkfwInstance instance, uint64_t maxTicks, VkfwBool32* pEventsRemaining) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    
+    VkfwResult result;
+    VkfwBool32 eventsRemaining = VKFW_FALSE;
+    uint64_t now = glfwGetTimerValue();
+    uint64_t budgetEnd = (maxTicks >= UINT64_MAX - now) ? UINT64_MAX : now + maxTicks;
+    
+    if(allocationTrackingEnabled) vkfwBeginAllocationFrame();
+    vkfwRewindScratch();
+    
+    glfwPollEvents();
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
-        case GLFW_INVALID_VALUE: return VKFW_ERROR_INVALID_NUMERIC_VALUE;
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
+    vkfwUpdateCursorVariants();
+    vkfwFlushTextInput(); /* part of the platform events, not of the work left for later */
+    
+    now = glfwGetTimerValue();
+    if(now < budgetEnd) {
+        result = vkfwProcessTimers(now);
+        if(result) return result;
+        now = glfwGetTimerValue();
+    } else if(vkfwGetNextTimerDeadline() <= now) eventsRemaining = VKFW_TRUE;
+    
+    if(joystickEventsEnabled && joystickSamplingPeriod == 0) {
+        if(now < budgetEnd) {
+            result = vkfwPollJoysticks(now, VKFW_FALSE);
+            if(result) return result;
+        } else eventsRemaining = VKFW_TRUE;
+    }
+    
+    if(pEventsRemaining != NULL) pEventsRemaining[0] = eventsRemaining;
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwResetScratchUntimed(VkfwInstance instance) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     
+    vkfwRewindScratch();
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetClipboardString(VkfwInstance instance, const char** pClipboardString) {
+static VkfwResult vkfwGetClipboardStringUntimed(VkfwInstance instance, const char** pClipboardString) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pClipboardString == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
-    pClipboardString[0] = glfwGetClipboardString(NULL);
+    const char* clipboardString = glfwGetClipboardString(NULL);
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
         case GLFW_FORMAT_UNAVAILABLE: return VKFW_ERROR_RESULT_NOT_AVAILABLE;
@@ -257,9 +2353,9 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetClipboardString(VkfwInstance insta
         default: return VKFW_ERROR_UNKNOWN;
     }
     
-    return VKFW_SUCCESS;
+    return vkfwCopyStringToScratch(clipboardString, pClipboardString);
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetClipboardString(VkfwInstance instance, const char* clipboardString) {
+static VkfwResult vkfwSetClipboardStringUntimed(VkfwInstance instance, const char* clipboardString) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     
@@ -274,7 +2370,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetClipboardString(VkfwInstance insta
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetTimerValue(VkfwInstance instance, uint64_t* pTimerValue) {
+static VkfwResult vkfwGetTimerValueUntimed(VkfwInstance instance, uint64_t* pTimerValue) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pTimerValue == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
@@ -284,7 +2380,211 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetTimerValue(VkfwInstance instance,
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitors(VkfwInstance instance, uint32_t* pMonitorCount, VkfwMonitor* pMonitors) {
+VKFWAPI_ATTR uint64_t     VKFWAPI_CALL vkfwGetTimestamp(void) {
+    /* without an instance, GLFW would leave an error that fails the next vkfwCreateInstance */
+    if(!vfkwInstanceInitialized) return 0;
+#if defined(VKFW_TIMESTAMP_COUNTER)
+    if(timestampSource == VKFW_TIMESTAMP_SOURCE_CPU_COUNTER) return __rdtsc();
+#endif
+#if defined(VKFW_MONOTONIC_TIMESTAMP)
+    if(timestampFromMonotonicClock) {
+        struct timespec clockValue;
+        clock_gettime(CLOCK_MONOTONIC, &clockValue);
+        return (uint64_t) clockValue.tv_sec * 1000000000 + (uint64_t) clockValue.tv_nsec;
+    }
+#endif
+    return glfwGetTimerValue();
+}
+static VkfwResult vkfwSetTimestampSourceUntimed(VkfwInstance instance, VkfwTimestampSource source) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    /* the recorded trace events are in ticks of the source, and the flush converts them with the frequency of the current one */
+    if(atomic_load(&traceEnabled) && source != timestampSource) return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+    
+    switch(source) {
+        case VKFW_TIMESTAMP_SOURCE_TIMER:
+            timestampSource = source;
+            timestampFrequency = timerFrequency;
+        break;
+        case VKFW_TIMESTAMP_SOURCE_CPU_COUNTER:
+#if defined(VKFW_TIMESTAMP_COUNTER)
+            if(!vkfwHasInvariantTimestampCounter()) return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+            if(timestampSource == source) return VKFW_SUCCESS; /* already calibrated */
+            timestampFrequency = vkfwCalibrateTimestampCounter();
+            if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+            timestampSource = source;
+        break;
+#else
+            return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+#endif
+        default: return VKFW_ERROR_INVALID_ENUM_VALUE;
+    }
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwGetTimestampFrequencyUntimed(VkfwInstance instance, uint64_t* pFrequency) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(pFrequency == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    pFrequency[0] = timestampFrequency;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwResetFrameClockUntimed(VkfwInstance instance, VkfwFrameClock* pFrameClock) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(pFrameClock == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    memset(pFrameClock, 0, sizeof(VkfwFrameClock));
+    pFrameClock[0].timestampFrequency   = timestampFrequency;
+    pFrameClock[0].previousTimestamp    = vkfwGetTimestamp();
+    pFrameClock[0].smoothingFactor      = 0.1;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwTickFrameClockUntimed(VkfwFrameClock* pFrameClock) {
+    if(pFrameClock == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pFrameClock[0].timestampFrequency == 0) return VKFW_ERROR_INITIALIZATION_FAILED; /* not reset by vkfwResetFrameClock */
+    
+    uint64_t now = vkfwGetTimestamp();
+    double delta = (double) (now - pFrameClock[0].previousTimestamp) / (double) pFrameClock[0].timestampFrequency;
+    
+    pFrameClock[0].previousTimestamp = now;
+    pFrameClock[0].delta = delta;
+    if(pFrameClock[0].frameCount == 0)  pFrameClock[0].smoothedDelta  = delta;
+    else                                pFrameClock[0].smoothedDelta += pFrameClock[0].smoothingFactor * (delta - pFrameClock[0].smoothedDelta);
+    pFrameClock[0].deltaHistory[pFrameClock[0].frameCount % VKFW_FRAME_CLOCK_HISTORY_LENGTH] = (float) delta;
+    pFrameClock[0].frameCount++;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwGetFrameClockPercentileUntimed(const VkfwFrameClock* pFrameClock, float percentile, double* pDelta) {
+    uint32_t i, j;
+    float sortedDeltas[VKFW_FRAME_CLOCK_HISTORY_LENGTH];
+    
+    if(pFrameClock == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pDelta == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(!(percentile >= 0.0f && percentile <= 100.0f)) return VKFW_ERROR_INVALID_NUMERIC_VALUE; /* also catches NaN */
+    if(pFrameClock[0].frameCount == 0) return VKFW_ERROR_RESULT_NOT_AVAILABLE;
+    
+    uint32_t deltaCount = (pFrameClock[0].frameCount < VKFW_FRAME_CLOCK_HISTORY_LENGTH) ? (uint32_t) pFrameClock[0].frameCount : VKFW_FRAME_CLOCK_HISTORY_LENGTH;
+    
+    /* an insertion sort is fast enough for the short history, and needs no allocations */
+    for(i = 0; i < deltaCount; i++) {
+        float delta = pFrameClock[0].deltaHistory[i];
+        for(j = i; j > 0 && sortedDeltas[j - 1] > delta; j--) sortedDeltas[j] = sortedDeltas[j - 1];
+        sortedDeltas[j] = delta;
+    }
+    
+    pDelta[0] = sortedDeltas[(uint32_t) (percentile / 100.0f * (float) (deltaCount - 1) + 0.5f)];
+    
+    return VKFW_SUCCESS;
+}
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetInstanceStatistics(VkfwInstance instance, VkfwStatistics* pStatistics) {
+    uint32_t i, j;
+    VkfwThreadInstrumentation* pInstrumentation;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(pStatistics == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(!atomic_load(&statisticsEnabled)) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* the instance has to be created with VKFW_INSTANCE_CREATE_ENABLE_STATISTICS_BIT */
+    
+    if(pStatistics[0].pEntryPoints == NULL) {
+        pStatistics[0].entryPointCount = VKFW_ENTRY_POINT_COUNT;
+        return VKFW_SUCCESS;
+    }
+    if(pStatistics[0].entryPointCount > VKFW_ENTRY_POINT_COUNT) pStatistics[0].entryPointCount = VKFW_ENTRY_POINT_COUNT;
+    
+    for(i = 0; i < pStatistics[0].entryPointCount; i++) {
+        VkfwEntryPointStatistics* pEntryPoint = &pStatistics[0].pEntryPoints[i];
+        memset(pEntryPoint, 0, sizeof(VkfwEntryPointStatistics));
+        pEntryPoint[0].name = entryPointNames[i];
+        for(pInstrumentation = atomic_load(&threadInstrumentationList); pInstrumentation != NULL; pInstrumentation = pInstrumentation[0].pNext) {
+            VkfwEntryPointCounters* pCounters = &pInstrumentation[0].entryPoints[i];
+            pEntryPoint[0].callCount           += atomic_load_explicit(&pCounters[0].callCount, memory_order_relaxed);
+            pEntryPoint[0].totalNanoseconds    += atomic_load_explicit(&pCounters[0].totalNanoseconds, memory_order_relaxed);
+            for(j = 0; j < VKFW_LATENCY_HISTOGRAM_BUCKET_COUNT; j++) pEntryPoint[0].latencyHistogram[j] += atomic_load_explicit(&pCounters[0].latencyHistogram[j], memory_order_relaxed);
+        }
+    }
+    
+    return VKFW_SUCCESS;
+}
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwFlushTrace(VkfwInstance instance, const char* path) {
+    uint32_t head, tail;
+    VkfwThreadInstrumentation* pInstrumentation;
+    const char* separator = "";
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(path == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(!atomic_load(&traceEnabled)) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* the instance has to be created with VKFW_INSTANCE_CREATE_ENABLE_TRACE_BIT */
+    
+    FILE* file = fopen(path, "w");
+    if(file == NULL) return VKFW_ERROR_PLATFORM_ERROR;
+    
+    /* the chrome trace event format, with the timestamps in microseconds of vkfwGetTimestamp, so that they line up with traces of the application */
+    fputs("{\"traceEvents\":[\n", file);
+    for(pInstrumentation = atomic_load(&threadInstrumentationList); pInstrumentation != NULL; pInstrumentation = pInstrumentation[0].pNext) {
+        VkfwTraceRing* pRing = pInstrumentation[0].pTraceRing;
+        if(pRing == NULL) continue;
+        
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"VKFW thread %u\"}}", separator,
+                pInstrumentation[0].threadIndex, pInstrumentation[0].threadIndex);
+        separator = ",\n";
+        
+        tail = atomic_load_explicit(&pRing[0].tail, memory_order_relaxed);
+        head = atomic_load_explicit(&pRing[0].head, memory_order_acquire);
+        for(; tail != head; tail++) {
+            const VkfwTraceEvent* pEvent = &pRing[0].events[tail % VKFW_TRACE_RING_LENGTH];
+            VkfwBool32 isCallback = (pEvent[0].kind == VKFW_TRACE_EVENT_CALLBACK) ? VKFW_TRUE : VKFW_FALSE;
+            
+            /* the name of a callback event is its event type, like keyInput, and that of a call the entry point */
+            fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{", separator,
+                    pEvent[0].name, isCallback ? "callback" : "api", (double) pEvent[0].timestamp * 1000000.0 / (double) timestampFrequency,
+                    (double) pEvent[0].duration * 1000000.0 / (double) timestampFrequency, pInstrumentation[0].threadIndex);
+            if(isCallback) fprintf(file, "\"event\":\"%s\"", pEvent[0].name);
+            if(pEvent[0].windowSerial != 0) fprintf(file, "%s\"window\":%llu", isCallback ? "," : "", (unsigned long long) pEvent[0].windowSerial);
+            fputs("}}", file);
+        }
+        atomic_store_explicit(&pRing[0].tail, tail, memory_order_release);
+        
+        uint64_t droppedEventCount = atomic_load_explicit(&pRing[0].droppedEventCount, memory_order_relaxed);
+        if(droppedEventCount > 0) {
+            fprintf(file, ",\n{\"name\":\"droppedEvents\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"count\":%llu}}",
+                    (double) vkfwGetTimestamp() * 1000000.0 / (double) timestampFrequency, pInstrumentation[0].threadIndex, (unsigned long long) droppedEventCount);
+        }
+    }
+    fputs("\n]}\n", file);
+    
+    int writeError = ferror(file);
+    if(fclose(file) != 0 || writeError) return VKFW_ERROR_PLATFORM_ERROR;
+    
+    return VKFW_SUCCESS;
+}
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetAllocationStatistics(VkfwInstance instance, VkfwAllocationStatistics* pStatistics) {
+    uint32_t i;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(pStatistics == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(!allocationTrackingEnabled) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* the instance has to be created with VKFW_INSTANCE_CREATE_ENABLE_ALLOCATION_TRACKING_BIT */
+    
+    for(i = 0; i <= VKFW_ALLOCATION_SUBSYSTEM_COUNT; i++) {
+        VkfwAllocationCounters* pCounters = (i < VKFW_ALLOCATION_SUBSYSTEM_COUNT) ? &pStatistics[0].subsystems[i] : &pStatistics[0].total;
+        pCounters[0].allocationCount                = atomic_load_explicit(&allocationCounters[i].allocationCount, memory_order_relaxed);
+        pCounters[0].freeCount                      = atomic_load_explicit(&allocationCounters[i].freeCount, memory_order_relaxed);
+        pCounters[0].allocatedBytes                 = atomic_load_explicit(&allocationCounters[i].allocatedBytes, memory_order_relaxed);
+        pCounters[0].liveBytes                      = atomic_load_explicit(&allocationCounters[i].liveBytes, memory_order_relaxed);
+        pCounters[0].peakLiveBytes                  = atomic_load_explicit(&allocationCounters[i].peakLiveBytes, memory_order_relaxed);
+        pCounters[0].previousFrameAllocationCount   = atomic_load_explicit(&allocationCounters[i].previousFrameAllocationCount, memory_order_relaxed);
+        pCounters[0].previousFrameAllocatedBytes    = atomic_load_explicit(&allocationCounters[i].previousFrameAllocatedBytes, memory_order_relaxed);
+    }
+    pStatistics[0].frameCount = atomic_load_explicit(&allocationFrameCount, memory_order_relaxed);
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwEnumerateMonitorsUntimed(VkfwInstance instance, uint32_t* pMonitorCount, VkfwMonitor* pMonitors) {
     uint32_t i;
 
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
@@ -302,7 +2602,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitors(VkfwInstance instan
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitorProperties(VkfwMonitor monitor, VkfwMonitorProperties* pProperties) {
+static VkfwResult vkfwEnumerateMonitorPropertiesUntimed(VkfwMonitor monitor, VkfwMonitorProperties* pProperties) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(monitor == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(pProperties == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
@@ -333,8 +2633,9 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitorProperties(VkfwMonito
         default: return VKFW_ERROR_UNKNOWN;
     }
     
-    pProperties[0].pName = glfwGetMonitorName(localMonitor);
+    const char* monitorName = glfwGetMonitorName(localMonitor);
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    if(vkfwCopyStringToScratch(monitorName, &pProperties[0].pName) != VKFW_SUCCESS) return VKFW_ERROR_OUT_OF_MEMORY;
     
     pProperties[0].pUserPointer = glfwGetMonitorUserPointer(localMonitor);
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
@@ -363,7 +2664,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitorProperties(VkfwMonito
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetMonitorUserPointer(VkfwMonitor monitor, void* pUserPointer) {
+static VkfwResult vkfwSetMonitorUserPointerUntimed(VkfwMonitor monitor, void* pUserPointer) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(monitor == NULL) return VKFW_ERROR_INVALID_HANDLE;
     
@@ -374,7 +2675,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetMonitorUserPointer(VkfwMonitor mon
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetMonitorGammaRamp(VkfwMonitor monitor, const VkfwGammaRamp* pGammaRamp) {
+static VkfwResult vkfwSetMonitorGammaRampUntimed(VkfwMonitor monitor, const VkfwGammaRamp* pGammaRamp) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(monitor == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(pGammaRamp == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
@@ -391,7 +2692,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetMonitorGammaRamp(VkfwMonitor monit
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetGammeRampFromGammaValue(VkfwMonitor monitor, float gamma, VkfwGammaRamp* pGammaRamp) {
+static VkfwResult vkfwGetGammeRampFromGammaValueUntimed(VkfwMonitor monitor, float gamma, VkfwGammaRamp* pGammaRamp) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(monitor == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(pGammaRamp == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
@@ -446,13 +2747,59 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetGammeRampFromGammaValue(VkfwMonito
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateWindow(VkfwMonitor monitor, const VkfwWindowCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwWindow* pWindow) {
+/* disabled event types get no GLFW callback at all, so that VKFW doesn't do any work for them either. the trampolines which also feed
+   VKFW itself, like the framebuffer size for the settled extent, are installed for enabled types even without a user callback. */
+static VkfwResult vkfwSetWindowCallbacks(GLFWwindow* windowHandle, const VkfwWindowCallbacks* pCallbacks, VkfwEventTypeFlags disabledEventTypes) {
+    VkfwBool32 characterInputUsed = (pCallbacks[0].unicodeCharacterInput != NULL || pCallbacks[0].textInput != NULL) ? VKFW_TRUE : VKFW_FALSE;
+    
+    glfwSetWindowPosCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_POSITION_CHANGE_BIT) ? NULL : ((pCallbacks[0].positionChange != NULL) ? vkfwWindowPositionTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetWindowSizeCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_SIZE_CHANGE_BIT) ? NULL : ((pCallbacks[0].sizeChange != NULL) ? vkfwWindowSizeTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetFramebufferSizeCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_FRAMEBUFFER_SIZE_CHANGE_BIT) ? NULL : vkfwWindowFramebufferSizeTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetWindowContentScaleCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_CONTENT_SCALE_CHANGE_BIT) ? NULL : vkfwWindowContentScaleTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetCursorPosCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_CURSOR_POSITION_CHANGE_BIT) ? NULL : ((pCallbacks[0].cursorPositionChange != NULL) ? vkfwWindowCursorPositionTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetWindowFocusCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_FOCUS_CHANGE_BIT) ? NULL : vkfwWindowFocusTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetWindowIconifyCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_ICONIFICATION_CHANGE_BIT) ? NULL : ((pCallbacks[0].iconficationChange != NULL) ? vkfwWindowIconifyTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetWindowMaximizeCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_MAXIMIZATION_CHANGE_BIT) ? NULL : ((pCallbacks[0].maximizationChange != NULL) ? vkfwWindowMaximizeTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    glfwSetWindowCloseCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_CLOSE_BUTTON_CLICKED_BIT) ? NULL : ((pCallbacks[0].closeButtonClicked != NULL) ? vkfwWindowCloseTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetWindowRefreshCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_CONTENT_AREA_NEEDS_TO_BE_REDRAWN_BIT) ? NULL : ((pCallbacks[0].contentAreaNeedsToBeRedrawn != NULL) ? vkfwWindowRefreshTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetDropCallback(windowHandle, ((disabledEventTypes & VKFW_EVENT_TYPE_PATH_DROP_BIT) || pCallbacks[0].pathDrop == NULL) ? NULL : vkfwWindowPathDropTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    glfwSetMouseButtonCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_MOUSE_BUTTON_INPUT_BIT) ? NULL : vkfwWindowMouseButtonTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetScrollCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_SCROLL_INPUT_BIT) ? NULL : ((pCallbacks[0].scrollInput != NULL) ? vkfwWindowScrollTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetCursorEnterCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_CURSOR_ENTER_OR_LEAVE_CONTENT_AREA_BIT) ? NULL : ((pCallbacks[0].cursorEnterOrLeaveContentArea != NULL) ? vkfwWindowCursorEnterTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetKeyCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_KEY_INPUT_BIT) ? NULL : vkfwWindowKeyTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetCharCallback(windowHandle, ((disabledEventTypes & VKFW_EVENT_TYPE_CHARACTER_INPUT_BIT) || !characterInputUsed) ? NULL : vkfwWindowCharTrampoline);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    glfwSetCharModsCallback(windowHandle, (disabledEventTypes & VKFW_EVENT_TYPE_CHARACTER_INPUT_BIT) ? NULL : ((pCallbacks[0].unicodeCharacterInputWithModifiers != NULL) ? vkfwWindowCharModsTrampoline : NULL));
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwCreateWindowUntimed(VkfwMonitor monitor, const VkfwWindowCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwWindow* pWindow) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(monitor == NULL) return VKFW_ERROR_INVALID_HANDLE; /* the GLFWmonitor* is set to NULL not by this parameter, but by the flag pCreateInfo[0].initialState.fullscreen */
     if(pCreateInfo == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     if(pWindow == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
-    if(pAllocator != initAllocator) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* we don't allow different allocators between instance and window since GLFW doesn't support it */
+    /* GLFW has one allocator per initialization, so only the memory of VKFW for the window comes from pAllocator */
+    VkfwAllocationCallbacks windowAllocator;
+    if(vkfwInitObjectAllocator(pAllocator, &windowAllocator) != VKFW_SUCCESS) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
     GLFWmonitor* underlyingMonitorHandle = (GLFWmonitor*) monitor;
     
@@ -460,6 +2807,9 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateWindow(VkfwMonitor monitor, con
     
     if(pCreateInfo[0].sType != VKFW_STRUCTURE_TYPE_WINDOW_CREATE_INFO)      return VKFW_ERROR_INVALID_ENUM_VALUE;
     if(pCreateInfo[0].pNext != NULL)                                        return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+    if(!(pCreateInfo[0].framebufferSettlePeriod >= 0.0))                   return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    if(pCreateInfo[0].textInputBufferSize != 0 && pCreateInfo[0].textInputBufferSize < 4) return VKFW_ERROR_INVALID_NUMERIC_VALUE; /* one encoded codepoint has to fit */
+    if(pCreateInfo[0].disabledEventTypes & ~VKFW_EVENT_TYPE_ALL)           return VKFW_ERROR_INVALID_ENUM_VALUE;
     
     if(pCreateInfo[0].flags & VKFW_WINDOW_CREATE_NO_INITIAL_FOCUS_BIT) {
         glfwWindowHint(GLFW_FOCUSED, GLFW_FALSE);
@@ -631,7 +2981,8 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateWindow(VkfwMonitor monitor, con
         default: return VKFW_ERROR_INVALID_ENUM_VALUE;
     }
     
-    GLFWwindow* underlyingWindowHandle = glfwCreateWindow(pCreateInfo[0].initialState.size.width, pCreateInfo[0].initialState.size.height, pCreateInfo[0].initialState.title, createParameterMonitorHandle, NULL);
+    GLFWwindow* underlyingWindowHandle;
+    underlyingWindowHandle = glfwCreateWindow(pCreateInfo[0].initialState.size.width, pCreateInfo[0].initialState.size.height, pCreateInfo[0].initialState.title, createParameterMonitorHandle, NULL);
     if(underlyingWindowHandle == NULL) {
         switch(glfwGetError(NULL)) {
             case GLFW_INVALID_VALUE:        return VKFW_ERROR_INVALID_NUMERIC_VALUE;
@@ -762,70 +3113,82 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateWindow(VkfwMonitor monitor, con
         switch(glfwGetError(NULL)) {
             case GLFW_NO_ERROR: break;
             case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
-            case GLFW_FEATURE_UNAVAILABLE: return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
-            default: return VKFW_ERROR_UNKNOWN;
-        }
-    }
-    glfwSetWindowUserPointer(underlyingWindowHandle, pCreateInfo[0].initialState.pUserPointer);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    
-    
-    /* 4. all the callbacks! */
-    
-    glfwSetWindowPosCallback(underlyingWindowHandle, (GLFWwindowposfun) pCreateInfo[0].callbacks.positionChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetWindowSizeCallback(underlyingWindowHandle, (GLFWwindowsizefun) pCreateInfo[0].callbacks.sizeChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetFramebufferSizeCallback(underlyingWindowHandle, (GLFWframebuffersizefun) pCreateInfo[0].callbacks.framebufferSizeChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetWindowContentScaleCallback(underlyingWindowHandle, (GLFWwindowcontentscalefun) pCreateInfo[0].callbacks.contentScaleChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetCursorPosCallback(underlyingWindowHandle, (GLFWcursorposfun) pCreateInfo[0].callbacks.cursorPositionChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetWindowFocusCallback(underlyingWindowHandle, (GLFWwindowfocusfun) pCreateInfo[0].callbacks.focusChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetWindowIconifyCallback(underlyingWindowHandle, (GLFWwindowiconifyfun) pCreateInfo[0].callbacks.iconficationChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetWindowMaximizeCallback(underlyingWindowHandle, (GLFWwindowmaximizefun) pCreateInfo[0].callbacks.maximizationChange);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+            case GLFW_FEATURE_UNAVAILABLE: return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+            default: return VKFW_ERROR_UNKNOWN;
+        }
+    }
     
-    glfwSetWindowCloseCallback(underlyingWindowHandle, (GLFWwindowclosefun) pCreateInfo[0].callbacks.closeButtonClicked);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetWindowRefreshCallback(underlyingWindowHandle, (GLFWwindowrefreshfun) pCreateInfo[0].callbacks.contentAreaNeedsToBeRedrawn);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetDropCallback(underlyingWindowHandle, (GLFWdropfun) pCreateInfo[0].callbacks.pathDrop);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    /* 4. all the callbacks! */
     
-    glfwSetMouseButtonCallback(underlyingWindowHandle, (GLFWmousebuttonfun) pCreateInfo[0].callbacks.mouseButtonInput);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetScrollCallback(underlyingWindowHandle, (GLFWscrollfun) pCreateInfo[0].callbacks.scrollInput);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetCursorEnterCallback(underlyingWindowHandle, (GLFWcursorenterfun) pCreateInfo[0].callbacks.cursorEnterOrLeaveContentArea);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetKeyCallback(underlyingWindowHandle, (GLFWkeyfun) pCreateInfo[0].callbacks.keyInput);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetCharCallback(underlyingWindowHandle, (GLFWcharfun) pCreateInfo[0].callbacks.unicodeCharacterInput);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    glfwSetCharModsCallback(underlyingWindowHandle, (GLFWcharmodsfun) pCreateInfo[0].callbacks.unicodeCharacterInputWithModifiers);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    VkfwResult callbackResult = vkfwSetWindowCallbacks(underlyingWindowHandle, &pCreateInfo[0].callbacks, pCreateInfo[0].disabledEventTypes);
+    if(callbackResult != VKFW_SUCCESS) return callbackResult;
     
     
     /* 5. finally, return the handle */
     
-    pWindow[0] = malloc(sizeof(VkfwWindow_t));
-    if(pWindow[0] == NULL) return VKFW_ERROR_OUT_OF_MEMORY;
+    VkfwExtent2D framebufferExtent;
+    glfwGetFramebufferSize(underlyingWindowHandle, &framebufferExtent.width, &framebufferExtent.height);
+    switch(glfwGetError(NULL)) {
+        case GLFW_NO_ERROR: break;
+        case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+        default: return VKFW_ERROR_UNKNOWN;
+    }
+    
+    uint32_t textInputBufferSize = 0;
+    if(pCreateInfo[0].callbacks.textInput != NULL) textInputBufferSize = (pCreateInfo[0].textInputBufferSize != 0) ? pCreateInfo[0].textInputBufferSize : VKFW_DEFAULT_TEXT_INPUT_BUFFER_SIZE;
+    size_t windowSize = sizeof(VkfwWindow_t) + ((textInputBufferSize != 0) ? (size_t) textInputBufferSize + 1 : 0);
+    pWindow[0] = vkfwAllocateWith(vkfwGetObjectAllocator(&windowAllocator), windowSize, VKFW_ALLOCATION_SUBSYSTEM_WINDOW);
+    if(pWindow[0] == NULL) {
+        glfwDestroyWindow(underlyingWindowHandle);
+        glfwGetError(NULL);
+        return VKFW_ERROR_OUT_OF_MEMORY;
+    }
     pWindow[0][0].monitorHandle = underlyingMonitorHandle;
     pWindow[0][0].windowHandle  = underlyingWindowHandle;
     pWindow[0][0].usedVideoMode = pCreateInfo[0].requestedVideoMode; /* at this point, creation was successful so the request for the mode was honored, so it is the actually used mode */
+    pWindow[0][0].pUserPointer  = pCreateInfo[0].initialState.pUserPointer;
+    pWindow[0][0].callbacks     = pCreateInfo[0].callbacks;
+    pWindow[0][0].activeCursor  = NULL;
+    pWindow[0][0].activeCursorSerial = 0;
+    pWindow[0][0].serial             = nextWindowSerial++;
+    pWindow[0][0].activeCursorFrames = NULL;
+    pWindow[0][0].activeCursorFrame  = 0;
+    pWindow[0][0].nextCursorFrameTime = 0;
+    pWindow[0][0].cursorVariantPending = VKFW_FALSE;
+    pWindow[0][0].cursorVariantScale = 1.0f;
+    pWindow[0][0].frameDeadlineOrigin   = 0;
+    pWindow[0][0].frameDeadlineIndex    = 0;
+    pWindow[0][0].frameDeadlineRefreshRate = 0;
+    pWindow[0][0].lastFrameDeadline     = 0;
+    pWindow[0][0].framebufferSettlePeriod   = (uint64_t) (pCreateInfo[0].framebufferSettlePeriod * (double) timerFrequency);
+    pWindow[0][0].framebufferSettleTime     = 0;
+    pWindow[0][0].framebufferSettlePending  = VKFW_FALSE;
+    atomic_init(&pWindow[0][0].settledFramebufferWidth,    framebufferExtent.width);
+    atomic_init(&pWindow[0][0].settledFramebufferHeight,   framebufferExtent.height);
+    atomic_init(&pWindow[0][0].settledFramebufferSequence, 0);
+    pWindow[0][0].allocator = windowAllocator;
+    pWindow[0][0].actionMap = NULL;
+    pWindow[0][0].disabledEventTypes = pCreateInfo[0].disabledEventTypes;
+    pWindow[0][0].textInputBuffer       = (textInputBufferSize != 0) ? (char*) &pWindow[0][1] : NULL;
+    pWindow[0][0].textInputBufferSize   = textInputBufferSize;
+    pWindow[0][0].textInputByteCount    = 0;
+    
+    glfwSetWindowUserPointer(underlyingWindowHandle, pWindow[0]);
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    pWindow[0][0].previousWindow = NULL;
+    pWindow[0][0].nextWindow     = windowList;
+    if(windowList != NULL) windowList[0].previousWindow = pWindow[0];
+    windowList = pWindow[0];
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyWindow(VkfwWindow window, const VkfwAllocationCallbacks* pAllocator) {
+static VkfwResult vkfwDestroyWindowUntimed(VkfwWindow window, const VkfwAllocationCallbacks* pAllocator) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
-    if(pAllocator != initAllocator) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(!vkfwIsObjectAllocatorCompatible(&window[0].allocator, pAllocator)) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
     glfwDestroyWindow(window[0].windowHandle);
     switch(glfwGetError(NULL)) {
@@ -834,11 +3197,20 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyWindow(VkfwWindow window, cons
         default: return VKFW_ERROR_UNKNOWN;
     }
     
-    free(window);
+    /* the releases of inputs held in this window won't arrive anymore */
+    if(window[0].actionMap != NULL) vkfwReleaseAllActions(window[0].actionMap);
+    vkfwSetActiveCursor(window, NULL, NULL);
+    if(window[0].framebufferSettlePending) pendingFramebufferSettleCount--;
+    if(window[0].textInputByteCount > 0) pendingTextInputWindowCount--; /* text typed just before destruction is dropped */
+    if(window[0].previousWindow != NULL) window[0].previousWindow[0].nextWindow = window[0].nextWindow;
+    else windowList = window[0].nextWindow;
+    if(window[0].nextWindow != NULL) window[0].nextWindow[0].previousWindow = window[0].previousWindow;
+    VkfwAllocationCallbacks windowAllocator = window[0].allocator; /* the copy in the window is freed with it */
+    vkfwFreeWith(vkfwGetObjectAllocator(&windowAllocator), window);
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateWindowProperties(VkfwWindow window, VkfwWindowProperties* pProperties) {
+static VkfwResult vkfwEnumerateWindowPropertiesUntimed(VkfwWindow window, VkfwWindowProperties* pProperties) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -955,8 +3327,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateWindowProperties(VkfwWindow
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
-    pProperties[0].state.pUserPointer = glfwGetWindowUserPointer(underlyingWindowHandle);
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    pProperties[0].state.pUserPointer = window[0].pUserPointer;
     
     pProperties[0].focused = glfwGetWindowAttrib(underlyingWindowHandle, GLFW_FOCUSED);
     switch(glfwGetError(NULL)) {
@@ -997,7 +3368,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateWindowProperties(VkfwWindow
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowState(VkfwWindow window, VkfwWindowState newState) {
+static VkfwResult vkfwSetWindowStateUntimed(VkfwWindow window, VkfwWindowState newState) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1008,7 +3379,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowState(VkfwWindow window, Vkf
     int32_t storedRefreshRate           = window[0].usedVideoMode.refreshRate;
     
     VkfwWindowProperties oldProperties;
-    VkfwResult result = vkfwEnumerateWindowProperties(window, &oldProperties);
+    VkfwResult result = vkfwEnumerateWindowPropertiesUntimed(window, &oldProperties);
     if(result) return result;
     
     if(oldProperties.state.fullscreen != newState.fullscreen) {
@@ -1352,14 +3723,11 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowState(VkfwWindow window, Vkf
             default: return VKFW_ERROR_UNKNOWN;
         }
     }
-    if(oldProperties.state.pUserPointer != newState.pUserPointer) {
-        glfwSetWindowUserPointer(underlyingWindowHandle, newState.pUserPointer);
-        if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    }
+    window[0].pUserPointer = newState.pUserPointer;
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowIcon(VkfwWindow window, uint32_t imageCount, const VkfwImageData* images) {
+static VkfwResult vkfwSetWindowIconUntimed(VkfwWindow window, uint32_t imageCount, const VkfwImageData* images) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1378,7 +3746,129 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowIcon(VkfwWindow window, uint
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSwitchWindowMonitor(VkfwWindow window, VkfwMonitor monitor, VkfwVideoMode* requestedVideoMode) {
+static VkfwResult vkfwSetWindowIconFromImageUntimed(VkfwWindow window, const VkfwImageData* pSourceImage) {
+    /* the platforms pick the closest of these for title bars, task bars and switchers at their content scale */
+    static const int32_t iconSizes[] = {16, 24, 32, 48, 64, 128, 256};
+    VkfwImageData images[sizeof(iconSizes) / sizeof(iconSizes[0])];
+    uint32_t i, imageCount;
+    int32_t longestSide;
+    size_t pixelMemorySize;
+    uint8_t* pixelMemory;
+    VkfwResult result;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(pSourceImage == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pSourceImage[0].pixels == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pSourceImage[0].width <= 0 || pSourceImage[0].height <= 0) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    
+    longestSide = (pSourceImage[0].width > pSourceImage[0].height) ? pSourceImage[0].width : pSourceImage[0].height;
+    if(longestSide <= iconSizes[0]) return vkfwSetWindowIconUntimed(window, 1, pSourceImage);
+    
+    /* sizes refer to the longest side, the aspect ratio of the source is kept */
+    imageCount = 0;
+    pixelMemorySize = 0;
+    for(i = 0; i < sizeof(iconSizes) / sizeof(iconSizes[0]) && iconSizes[i] <= longestSide; i++) {
+        images[imageCount].width  = (pSourceImage[0].width  * iconSizes[i] + longestSide / 2) / longestSide;
+        images[imageCount].height = (pSourceImage[0].height * iconSizes[i] + longestSide / 2) / longestSide;
+        if(images[imageCount].width  < 1) images[imageCount].width  = 1;
+        if(images[imageCount].height < 1) images[imageCount].height = 1;
+        pixelMemorySize += (size_t) images[imageCount].width * images[imageCount].height * 4;
+        imageCount++;
+    }
+    
+    pixelMemory = vkfwAllocateWith(vkfwGetObjectAllocator(&window[0].allocator), pixelMemorySize, VKFW_ALLOCATION_SUBSYSTEM_WINDOW);
+    if(pixelMemory == NULL) return VKFW_ERROR_OUT_OF_MEMORY;
+    pixelMemorySize = 0;
+    for(i = 0; i < imageCount; i++) {
+        images[i].pixels = pixelMemory + pixelMemorySize;
+        pixelMemorySize += (size_t) images[i].width * images[i].height * 4;
+        result = vkfwDownscaleImage(pSourceImage, &images[i], vkfwGetObjectAllocator(&window[0].allocator));
+        if(result != VKFW_SUCCESS) {
+            vkfwFreeWith(vkfwGetObjectAllocator(&window[0].allocator), pixelMemory);
+            return result;
+        }
+    }
+    
+    /* GLFW copies the images, so they can be freed right after */
+    result = vkfwSetWindowIconUntimed(window, imageCount, images);
+    vkfwFreeWith(vkfwGetObjectAllocator(&window[0].allocator), pixelMemory);
+    
+    return result;
+}
+static VkfwResult vkfwGetWindowFramebufferExtentUntimed(VkfwWindow window, VkfwExtent2D* pExtent, uint64_t* pGeneration) {
+    uint64_t sequence;
+    
+    /* this is polled from render threads, so only the pointers are checked */
+    if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(pExtent == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    do {
+        sequence = atomic_load(&window[0].settledFramebufferSequence);
+        pExtent[0].width  = atomic_load(&window[0].settledFramebufferWidth);
+        pExtent[0].height = atomic_load(&window[0].settledFramebufferHeight);
+    } while((sequence & 1) || sequence != atomic_load(&window[0].settledFramebufferSequence));
+    
+    if(pGeneration != NULL) pGeneration[0] = sequence / 2;
+    
+    return VKFW_SUCCESS;
+}
+/* the time from the origin to a frame in timer ticks, with the rate as an exact fraction and the product split so that it can't overflow.
+   GLFW reports integer refresh rates. Windows rounds the NTSC style rates like 59.94 Hz, which are 1000/1001 of a multiple of 6 Hz, down,
+   so a rate one below a multiple of 6 Hz is taken to be such a rate; the other platforms round them to the nearest and can't be told apart. */
+static uint64_t vkfwGetFrameOffset(uint64_t frameIndex, int32_t refreshRate) {
+    uint64_t rateNumerator = (uint64_t) refreshRate, rateDenominator = 1;
+    if(refreshRate >= 23 && (refreshRate + 1) % 6 == 0) {
+        rateNumerator = (uint64_t) (refreshRate + 1) * 1000;
+        rateDenominator = 1001;
+    }
+    return (frameIndex / rateNumerator) * timerFrequency * rateDenominator + (frameIndex % rateNumerator) * timerFrequency * rateDenominator / rateNumerator;
+}
+static VkfwResult vkfwGetWindowNextFrameDeadlineUntimed(VkfwWindow window, uint64_t previousDeadline, uint64_t* pDeadline) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(pDeadline == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    const GLFWvidmode* videoMode = glfwGetVideoMode(window[0].monitorHandle);
+    switch(glfwGetError(NULL)) {
+        case GLFW_NO_ERROR: break;
+        case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+        default: return VKFW_ERROR_UNKNOWN;
+    }
+    if(videoMode == NULL || videoMode[0].refreshRate <= 0) return VKFW_ERROR_RESULT_NOT_AVAILABLE; /* the platform doesn't know the refresh rate */
+    
+    int32_t rate = videoMode[0].refreshRate;
+    uint64_t framePeriod = vkfwGetFrameOffset(1, rate); /* rounded down */
+    uint64_t now = glfwGetTimerValue();
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    /* the first frame, a changed refresh rate and a deadline that wasn't returned last for this window start a new origin */
+    if(previousDeadline == 0 || previousDeadline != window[0].lastFrameDeadline || rate != window[0].frameDeadlineRefreshRate) {
+        window[0].frameDeadlineOrigin   = (previousDeadline != 0 && previousDeadline <= now + framePeriod) ? previousDeadline : now;
+        window[0].frameDeadlineIndex    = 0;
+        window[0].frameDeadlineRefreshRate = rate;
+    }
+    uint64_t origin = window[0].frameDeadlineOrigin;
+    uint64_t frameIndex = window[0].frameDeadlineIndex + 1;
+    
+    /* missed frames are skipped, keeping the phase of the previous deadlines, rather than scheduling a burst of late frames. the estimate
+       from the rounded period is at most a few frames too late, even after hours. */
+    if(origin + vkfwGetFrameOffset(frameIndex, rate) <= now) {
+        frameIndex = (now - origin) / framePeriod + 1;
+        while(frameIndex > window[0].frameDeadlineIndex + 1 && origin + vkfwGetFrameOffset(frameIndex - 1, rate) > now) frameIndex--;
+        while(origin + vkfwGetFrameOffset(frameIndex, rate) <= now) frameIndex++;
+    }
+    window[0].frameDeadlineIndex    = frameIndex;
+    window[0].lastFrameDeadline     = origin + vkfwGetFrameOffset(frameIndex, rate);
+    pDeadline[0] = window[0].lastFrameDeadline;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwSwitchWindowMonitorUntimed(VkfwWindow window, VkfwMonitor monitor, VkfwVideoMode* requestedVideoMode) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1430,7 +3920,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSwitchWindowMonitor(VkfwWindow window
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwFocusWindow(VkfwWindow window) {
+static VkfwResult vkfwFocusWindowUntimed(VkfwWindow window) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1447,7 +3937,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwFocusWindow(VkfwWindow window) {
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwRequestWindowAttention(VkfwWindow window) {
+static VkfwResult vkfwRequestWindowAttentionUntimed(VkfwWindow window) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1464,7 +3954,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwRequestWindowAttention(VkfwWindow win
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowAspectRatio(VkfwWindow window, int32_t numerator, int32_t denominator) {
+static VkfwResult vkfwSetWindowAspectRatioUntimed(VkfwWindow window, int32_t numerator, int32_t denominator) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1482,7 +3972,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowAspectRatio(VkfwWindow windo
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowSizeLimits(VkfwWindow window, VkfwExtent2D minimum, VkfwExtent2D maximum) {
+static VkfwResult vkfwSetWindowSizeLimitsUntimed(VkfwWindow window, VkfwExtent2D minimum, VkfwExtent2D maximum) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
@@ -1500,102 +3990,384 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowSizeLimits(VkfwWindow window
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateCursor(VkfwInstance instance, const VkfwCursorCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwCursor* pCursor) {
+static VkfwResult vkfwCreateCursorUntimed(VkfwInstance instance, const VkfwCursorCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwCursor* pCursor) {
+    uint32_t i, j;
+    size_t pixelMemorySize;
+    uint8_t* pixelMemory;
+    
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pCreateInfo == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     if(pCursor == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
-    if(pAllocator != initAllocator) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* we don't allow different allocators between instance and cursor since GLFW doesn't support it */
+    /* GLFW has one allocator per initialization, so only the memory of VKFW for the cursor comes from pAllocator */
+    VkfwAllocationCallbacks cursorAllocator;
+    if(vkfwInitObjectAllocator(pAllocator, &cursorAllocator) != VKFW_SUCCESS) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
     if(pCreateInfo[0].sType != VKFW_STRUCTURE_TYPE_CURSOR_CREATE_INFO)      return VKFW_ERROR_INVALID_ENUM_VALUE;
     if(pCreateInfo[0].pNext != NULL)                                        return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
     
-    /* currently no flags, so we ignore it */
+    if(pCreateInfo[0].shape != VKFW_CURSOR_SHAPE_CUSTOM && (pCreateInfo[0].shape < VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR || pCreateInfo[0].shape > VKFW_CURSOR_SHAPE_STANDARD_NOT_ALLOWED_CURSOR)) return VKFW_ERROR_INVALID_ENUM_VALUE;
+    if(pCreateInfo[0].shape == VKFW_CURSOR_SHAPE_CUSTOM && pCreateInfo[0].customCursorImageData == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    uint32_t frameCount = (pCreateInfo[0].customCursorFrameCount > 1) ? pCreateInfo[0].customCursorFrameCount : 1;
+    VkfwBool32 scaleWithContent = (pCreateInfo[0].flags & VKFW_CURSOR_CREATE_SCALE_WITH_CONTENT_BIT) ? VKFW_TRUE : VKFW_FALSE;
+    if(frameCount > 1 || scaleWithContent) {
+        if(pCreateInfo[0].shape != VKFW_CURSOR_SHAPE_CUSTOM) return VKFW_ERROR_INVALID_ENUM_VALUE;
+    }
+    if(frameCount > 1) {
+        if(!(pCreateInfo[0].customCursorFrameDuration > 0.0)) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    }
+    if(scaleWithContent) {
+        for(i = 0; i < frameCount; i++) {
+            if(pCreateInfo[0].customCursorImageData[i].pixels == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+            if(pCreateInfo[0].customCursorBaseSize.width  <= 0 || pCreateInfo[0].customCursorBaseSize.width  > pCreateInfo[0].customCursorImageData[i].width)  return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+            if(pCreateInfo[0].customCursorBaseSize.height <= 0 || pCreateInfo[0].customCursorBaseSize.height > pCreateInfo[0].customCursorImageData[i].height) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+        }
+    }
     
     GLFWcursor* underlyingCursorHandle;
+    VkfwCursor* pCacheEntry = NULL;
+    VkfwResult result;
+    
+    if(pCreateInfo[0].shape >= VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR && pCreateInfo[0].shape <= VKFW_CURSOR_SHAPE_STANDARD_NOT_ALLOWED_CURSOR) {
+        /* the shared standard cursors outlive the callers creating them, so they always use the allocator of the instance */
+        memset(&cursorAllocator, 0, sizeof(cursorAllocator));
+        pCacheEntry = &standardCursorCache[pCreateInfo[0].shape - VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR];
+        if(pCacheEntry[0] != NULL) {
+            pCacheEntry[0][0].referenceCount++;
+            pCursor[0] = pCacheEntry[0];
+            return VKFW_SUCCESS;
+        }
+    }
     
-    switch(pCreateInfo[0].shape) {
-        case VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR        :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_ARROW_CURSOR        ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_IBEAM_CURSOR        :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_IBEAM_CURSOR        ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_CROSSHAIR_CURSOR    :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_CROSSHAIR_CURSOR    ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_POINTING_HAND_CURSOR:  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_POINTING_HAND_CURSOR); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_EW_CURSOR    :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_EW_CURSOR    ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_NS_CURSOR    :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_NS_CURSOR    ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_NWSE_CURSOR  :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_NWSE_CURSOR  ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_NESW_CURSOR  :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_NESW_CURSOR  ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_ALL_CURSOR   :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_ALL_CURSOR   ); break;
-        case VKFW_CURSOR_SHAPE_STANDARD_NOT_ALLOWED_CURSOR  :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_NOT_ALLOWED_CURSOR  ); break;
-        case VKFW_CURSOR_SHAPE_CUSTOM                       :  underlyingCursorHandle = glfwCreateCursor((const GLFWimage *) pCreateInfo[0].customCursorImageData,
-                                                                    pCreateInfo[0].customCursorHotspotCoordinate.x, pCreateInfo[0].customCursorHotspotCoordinate.y); break;
-        default: return VKFW_ERROR_INVALID_ENUM_VALUE;
+    pCursor[0] = vkfwAllocateWith(vkfwGetObjectAllocator(&cursorAllocator), sizeof(VkfwCursor_t), VKFW_ALLOCATION_SUBSYSTEM_CURSOR);
+    if(pCursor[0] == NULL) return VKFW_ERROR_OUT_OF_MEMORY;
+    pCursor[0][0].shape             = pCreateInfo[0].shape;
+    pCursor[0][0].referenceCount    = 1;
+    pCursor[0][0].frameCount        = frameCount;
+    pCursor[0][0].frameDuration     = (frameCount > 1) ? (uint64_t) (pCreateInfo[0].customCursorFrameDuration * (double) timerFrequency) : 0;
+    if(frameCount > 1 && pCursor[0][0].frameDuration == 0) pCursor[0][0].frameDuration = 1;
+    pCursor[0][0].frameHandles      = &pCursor[0][0].cursorHandle;
+    pCursor[0][0].sourceImages      = NULL;
+    pCursor[0][0].allocator         = cursorAllocator;
+    pCursor[0][0].variantCount      = 0;
+    
+    if(scaleWithContent) {
+        /* the source frames are copied to be downscaled later for other content scales, and the base size variant created right away */
+        pixelMemorySize = 0;
+        for(i = 0; i < frameCount; i++) pixelMemorySize += (size_t) pCreateInfo[0].customCursorImageData[i].width * pCreateInfo[0].customCursorImageData[i].height * 4;
+        pCursor[0][0].sourceImages = vkfwAllocateWith(vkfwGetObjectAllocator(&cursorAllocator), frameCount * sizeof(VkfwImageData) + pixelMemorySize, VKFW_ALLOCATION_SUBSYSTEM_CURSOR);
+        if(pCursor[0][0].sourceImages == NULL) {
+            vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0]);
+            return VKFW_ERROR_OUT_OF_MEMORY;
+        }
+        pixelMemory = (uint8_t*) (pCursor[0][0].sourceImages + frameCount);
+        for(i = 0; i < frameCount; i++) {
+            pCursor[0][0].sourceImages[i].width  = pCreateInfo[0].customCursorImageData[i].width;
+            pCursor[0][0].sourceImages[i].height = pCreateInfo[0].customCursorImageData[i].height;
+            pCursor[0][0].sourceImages[i].pixels = pixelMemory;
+            memcpy(pixelMemory, pCreateInfo[0].customCursorImageData[i].pixels, (size_t) pCreateInfo[0].customCursorImageData[i].width * pCreateInfo[0].customCursorImageData[i].height * 4);
+            pixelMemory += (size_t) pCreateInfo[0].customCursorImageData[i].width * pCreateInfo[0].customCursorImageData[i].height * 4;
+        }
+        pCursor[0][0].baseSize    = pCreateInfo[0].customCursorBaseSize;
+        pCursor[0][0].baseHotspot = pCreateInfo[0].customCursorHotspotCoordinate;
+        
+        result = vkfwCreateCursorVariant(pCursor[0], pCursor[0][0].baseSize, &pCursor[0][0].variants[0]);
+        if(result != VKFW_SUCCESS) {
+            vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0][0].sourceImages);
+            vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0]);
+            return result;
+        }
+        pCursor[0][0].variantCount  = 1;
+        pCursor[0][0].frameHandles  = pCursor[0][0].variants[0].frameHandles;
+        pCursor[0][0].cursorHandle  = pCursor[0][0].frameHandles[0];
+        pCursor[0][0].serial        = nextCursorSerial++;
+        
+        return VKFW_SUCCESS;
     }
-    if(underlyingCursorHandle == NULL) {
-        if(pCreateInfo[0].shape == VKFW_CURSOR_SHAPE_CUSTOM) {
-            switch(glfwGetError(NULL)) {
-                case GLFW_INVALID_VALUE: return VKFW_ERROR_INVALID_NUMERIC_VALUE;
-                case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
-                default: return VKFW_ERROR_UNKNOWN;
-            }
-        } else {
-            switch(glfwGetError(NULL)) {
-                case GLFW_CURSOR_UNAVAILABLE: return VKFW_ERROR_CURSOR_SHAPE_NOT_SUPPORTED;
-                case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
-                default: return VKFW_ERROR_UNKNOWN;
+    if(frameCount > 1) {
+        pCursor[0][0].frameHandles = vkfwAllocateWith(vkfwGetObjectAllocator(&cursorAllocator), frameCount * sizeof(GLFWcursor*), VKFW_ALLOCATION_SUBSYSTEM_CURSOR);
+        if(pCursor[0][0].frameHandles == NULL) {
+            vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0][0].sourceImages);
+            vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0]);
+            return VKFW_ERROR_OUT_OF_MEMORY;
+        }
+    }
+    
+    result = VKFW_SUCCESS;
+    for(i = 0; i < frameCount; i++) {
+        switch(pCreateInfo[0].shape) {
+            case VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR        :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_ARROW_CURSOR        ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_IBEAM_CURSOR        :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_IBEAM_CURSOR        ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_CROSSHAIR_CURSOR    :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_CROSSHAIR_CURSOR    ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_POINTING_HAND_CURSOR:  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_POINTING_HAND_CURSOR); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_EW_CURSOR    :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_EW_CURSOR    ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_NS_CURSOR    :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_NS_CURSOR    ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_NWSE_CURSOR  :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_NWSE_CURSOR  ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_NESW_CURSOR  :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_NESW_CURSOR  ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_RESIZE_ALL_CURSOR   :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_RESIZE_ALL_CURSOR   ); break;
+            case VKFW_CURSOR_SHAPE_STANDARD_NOT_ALLOWED_CURSOR  :  underlyingCursorHandle = glfwCreateStandardCursor(GLFW_NOT_ALLOWED_CURSOR  ); break;
+            case VKFW_CURSOR_SHAPE_CUSTOM                       :  underlyingCursorHandle = glfwCreateCursor((const GLFWimage *) &pCreateInfo[0].customCursorImageData[i],
+                                                                        pCreateInfo[0].customCursorHotspotCoordinate.x, pCreateInfo[0].customCursorHotspotCoordinate.y); break;
+            default: underlyingCursorHandle = NULL; break; /* the shape was validated above */
+        }
+        if(underlyingCursorHandle == NULL) {
+            if(pCreateInfo[0].shape == VKFW_CURSOR_SHAPE_CUSTOM) {
+                switch(glfwGetError(NULL)) {
+                    case GLFW_INVALID_VALUE: result = VKFW_ERROR_INVALID_NUMERIC_VALUE; break;
+                    case GLFW_PLATFORM_ERROR: result = VKFW_ERROR_PLATFORM_ERROR; break;
+                    default: result = VKFW_ERROR_UNKNOWN; break;
+                }
+            } else {
+                switch(glfwGetError(NULL)) {
+                    case GLFW_CURSOR_UNAVAILABLE: result = VKFW_ERROR_CURSOR_SHAPE_NOT_SUPPORTED; break;
+                    case GLFW_PLATFORM_ERROR: result = VKFW_ERROR_PLATFORM_ERROR; break;
+                    default: result = VKFW_ERROR_UNKNOWN; break;
+                }
             }
+            break;
         }
+        pCursor[0][0].frameHandles[i] = underlyingCursorHandle;
+    }
+    if(result == VKFW_SUCCESS && glfwGetError(NULL)) result = VKFW_ERROR_UNKNOWN;
+    if(result != VKFW_SUCCESS) {
+        /* the first i frames were created */
+        for(j = 0; j < i; j++) glfwDestroyCursor(pCursor[0][0].frameHandles[j]);
+        glfwGetError(NULL);
+        if(frameCount > 1) vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0][0].frameHandles);
+        vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0][0].sourceImages);
+        vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), pCursor[0]);
+        return result;
     }
-    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
     
-    pCursor[0] = (VkfwCursor) underlyingCursorHandle;
+    pCursor[0][0].cursorHandle      = pCursor[0][0].frameHandles[0];
+    pCursor[0][0].serial            = nextCursorSerial++;
+    if(pCacheEntry != NULL) pCacheEntry[0] = pCursor[0];
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyCursor(VkfwCursor cursor, const VkfwAllocationCallbacks* pAllocator) {
+static VkfwResult vkfwDestroyCursorUntimed(VkfwCursor cursor, const VkfwAllocationCallbacks* pAllocator) {
+    uint32_t i, j;
+    VkfwWindow window;
+    
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(cursor == NULL) return VKFW_ERROR_INVALID_HANDLE;
-    if(pAllocator != initAllocator) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(cursor[0].cursorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(cursor[0].shape == VKFW_CURSOR_SHAPE_CUSTOM && !vkfwIsObjectAllocatorCompatible(&cursor[0].allocator, pAllocator)) return VKFW_ERROR_INVALID_POINTER_VALUE;
     
-    GLFWcursor* underlyingCursorHandle = (GLFWcursor*) cursor;
+    /* shared standard cursors stay alive until their last reference is destroyed */
+    cursor[0].referenceCount--;
+    if(cursor[0].referenceCount > 0) return VKFW_SUCCESS;
     
-    glfwDestroyCursor(underlyingCursorHandle);
+    if(cursor[0].variantCount == 0) {
+        for(j = 0; j < cursor[0].frameCount; j++) glfwDestroyCursor(cursor[0].frameHandles[j]);
+    } else {
+        for(i = 0; i < cursor[0].variantCount; i++) {
+            for(j = 0; j < cursor[0].frameCount; j++) glfwDestroyCursor(cursor[0].variants[i].frameHandles[j]);
+        }
+    }
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
     
+    /* GLFW reverts the windows that used the cursor to the default one */
+    for(window = windowList; window != NULL; window = window[0].nextWindow) {
+        if(window[0].activeCursor == cursor) vkfwSetActiveCursor(window, NULL, NULL);
+    }
+    
+    if(cursor[0].shape != VKFW_CURSOR_SHAPE_CUSTOM) standardCursorCache[cursor[0].shape - VKFW_CURSOR_SHAPE_STANDARD_ARROW_CURSOR] = NULL;
+    VkfwAllocationCallbacks cursorAllocator = cursor[0].allocator; /* the copy in the cursor is freed with it */
+    if(cursor[0].variantCount == 0) {
+        if(cursor[0].frameHandles != &cursor[0].cursorHandle) vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), cursor[0].frameHandles);
+    } else {
+        for(i = 0; i < cursor[0].variantCount; i++) vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), cursor[0].variants[i].frameHandles);
+    }
+    vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), cursor[0].sourceImages);
+    vkfwFreeWith(vkfwGetObjectAllocator(&cursorAllocator), cursor);
+    
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowCursor(VkfwWindow window, VkfwCursor cursor) {
+static VkfwResult vkfwSetWindowCursorUntimed(VkfwWindow window, VkfwCursor cursor) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(window[0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
     if(cursor == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(cursor[0].cursorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    
+    /* UI code sets the cursor on every mouse move, so skip the platform call if nothing would change. this also keeps animations running. */
+    if(window[0].activeCursorSerial == cursor[0].serial) return VKFW_SUCCESS;
     
     GLFWwindow* underlyingWindowHandle  = window[0].windowHandle;
-    GLFWcursor* underlyingCursorHandle = (GLFWcursor*) cursor;
+    GLFWcursor** frameHandles = cursor[0].frameHandles;
+    
+    if(cursor[0].variantCount > 0) {
+        float xScale, yScale;
+        glfwGetWindowContentScale(underlyingWindowHandle, &xScale, &yScale);
+        switch(glfwGetError(NULL)) {
+            case GLFW_NO_ERROR: break;
+            case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+            default: return VKFW_ERROR_UNKNOWN;
+        }
+        VkfwBool32 variantMissing;
+        VkfwResult result = vkfwGetCursorVariant(cursor, (xScale > yScale) ? xScale : yScale, VKFW_TRUE, &frameHandles, &variantMissing);
+        if(result != VKFW_SUCCESS) return result;
+    }
     
-    glfwSetCursor(underlyingWindowHandle, underlyingCursorHandle);
+    glfwSetCursor(underlyingWindowHandle, frameHandles[0]);
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
     
+    vkfwSetActiveCursor(window, cursor, frameHandles);
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwCreateActionMapUntimed(VkfwInstance instance, const VkfwActionMapCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwActionMap* pActionMap) {
+    uint32_t i;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(pCreateInfo == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pActionMap == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    VkfwAllocationCallbacks actionMapAllocator;
+    if(vkfwInitObjectAllocator(pAllocator, &actionMapAllocator) != VKFW_SUCCESS) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    if(pCreateInfo[0].sType != VKFW_STRUCTURE_TYPE_ACTION_MAP_CREATE_INFO)  return VKFW_ERROR_INVALID_ENUM_VALUE;
+    if(pCreateInfo[0].pNext != NULL)                                        return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
+    if(pCreateInfo[0].flags != 0)                                           return VKFW_ERROR_INVALID_ENUM_VALUE;
+    if(pCreateInfo[0].actionCount == 0 || pCreateInfo[0].actionCount > VKFW_ACTION_MAP_MAX_ACTIONS) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    VkfwResult result = vkfwValidateActionBindings(pCreateInfo[0].actionCount, pCreateInfo[0].bindingCount, pCreateInfo[0].pBindings);
+    if(result != VKFW_SUCCESS) return result;
+    
+    /* one allocation, with the state arrays behind the table */
+    uint32_t stateWordCount = (pCreateInfo[0].actionCount + 63) / 64;
+    size_t size = sizeof(VkfwActionMap_t) + stateWordCount * sizeof(uint64_t) + pCreateInfo[0].actionCount * sizeof(uint32_t);
+    pActionMap[0] = vkfwAllocateWith(vkfwGetObjectAllocator(&actionMapAllocator), size, VKFW_ALLOCATION_SUBSYSTEM_ACTION_MAP);
+    if(pActionMap[0] == NULL) return VKFW_ERROR_OUT_OF_MEMORY;
+    
+    pActionMap[0][0].actionCount = pCreateInfo[0].actionCount;
+    pActionMap[0][0].stateBits   = (uint64_t*) &pActionMap[0][1];
+    pActionMap[0][0].heldCounts  = (uint32_t*) &pActionMap[0][0].stateBits[stateWordCount];
+    for(i = 0; i < stateWordCount; i++) pActionMap[0][0].stateBits[i] = 0;
+    for(i = 0; i < pCreateInfo[0].actionCount; i++) pActionMap[0][0].heldCounts[i] = 0;
+    vkfwResetPressedActions(pActionMap[0]);
+    pActionMap[0][0].actionEvent = pCreateInfo[0].actionEvent;
+    pActionMap[0][0].pUserData   = pCreateInfo[0].pUserData;
+    pActionMap[0][0].allocator   = actionMapAllocator;
+    vkfwCompileActionMap(pActionMap[0], pCreateInfo[0].bindingCount, pCreateInfo[0].pBindings);
+    
+    if(pActionMap[0][0].hasGamepadBindings) {
+        gamepadActionMapCount++;
+        vkfwUpdateJoystickEventsEnabled();
+    }
+    pActionMap[0][0].previousActionMap = NULL;
+    pActionMap[0][0].nextActionMap     = actionMapList;
+    if(actionMapList != NULL) actionMapList[0].previousActionMap = pActionMap[0];
+    actionMapList = pActionMap[0];
+    
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwUpdateGamepadMappings(VkfwInstance instance, uint32_t mappingCount, const VkfwGamepadMapping* mappings) {
+static VkfwResult vkfwDestroyActionMapUntimed(VkfwActionMap actionMap, const VkfwAllocationCallbacks* pAllocator) {
+    VkfwWindow window;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(actionMap == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(!vkfwIsObjectAllocatorCompatible(&actionMap[0].allocator, pAllocator)) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    for(window = windowList; window != NULL; window = window[0].nextWindow) {
+        if(window[0].actionMap == actionMap) window[0].actionMap = NULL;
+    }
+    if(actionMap[0].hasGamepadBindings) {
+        gamepadActionMapCount--;
+        vkfwUpdateJoystickEventsEnabled();
+    }
+    
+    if(actionMap[0].previousActionMap != NULL) actionMap[0].previousActionMap[0].nextActionMap = actionMap[0].nextActionMap;
+    else actionMapList = actionMap[0].nextActionMap;
+    if(actionMap[0].nextActionMap != NULL) actionMap[0].nextActionMap[0].previousActionMap = actionMap[0].previousActionMap;
+    VkfwAllocationCallbacks actionMapAllocator = actionMap[0].allocator; /* the copy in the map is freed with it */
+    vkfwFreeWith(vkfwGetObjectAllocator(&actionMapAllocator), actionMap);
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwSetActionMapBindingsUntimed(VkfwActionMap actionMap, uint32_t bindingCount, const VkfwActionBinding* pBindings) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(actionMap == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    
+    VkfwResult result = vkfwValidateActionBindings(actionMap[0].actionCount, bindingCount, pBindings);
+    if(result != VKFW_SUCCESS) return result;
+    
+    /* the held inputs may not map to the same actions anymore, so nothing stays held */
+    vkfwReleaseAllActions(actionMap);
+    
+    VkfwBool32 hadGamepadBindings = actionMap[0].hasGamepadBindings;
+    vkfwCompileActionMap(actionMap, bindingCount, pBindings);
+    if(actionMap[0].hasGamepadBindings != hadGamepadBindings) {
+        if(actionMap[0].hasGamepadBindings) gamepadActionMapCount++;
+        else gamepadActionMapCount--;
+        vkfwUpdateJoystickEventsEnabled();
+    }
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwGetActionMapStateUntimed(VkfwActionMap actionMap, uint64_t* pStateBits) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(actionMap == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(pStateBits == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    memcpy(pStateBits, actionMap[0].stateBits, ((actionMap[0].actionCount + 63) / 64) * sizeof(uint64_t));
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwSetWindowActionMapUntimed(VkfwWindow window, VkfwActionMap actionMap) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    
+    if(window[0].actionMap == actionMap) return VKFW_SUCCESS;
+    /* the releases of inputs held in this window won't reach the old map anymore */
+    if(window[0].actionMap != NULL) vkfwReleaseAllActions(window[0].actionMap);
+    window[0].actionMap = actionMap;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwSetWindowDisabledEventTypesUntimed(VkfwWindow window, VkfwEventTypeFlags disabledEventTypes) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(window == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(window[0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    if(disabledEventTypes & ~VKFW_EVENT_TYPE_ALL) return VKFW_ERROR_INVALID_ENUM_VALUE;
+    
+    if(window[0].disabledEventTypes == disabledEventTypes) return VKFW_SUCCESS;
+    
+    VkfwResult result = vkfwSetWindowCallbacks(window[0].windowHandle, &window[0].callbacks, disabledEventTypes);
+    if(result != VKFW_SUCCESS) return result;
+    
+    /* the releases of the held keys and buttons won't arrive anymore */
+    VkfwEventTypeFlags newlyDisabled = disabledEventTypes & ~window[0].disabledEventTypes;
+    if(window[0].actionMap != NULL && (newlyDisabled & (VKFW_EVENT_TYPE_KEY_INPUT_BIT | VKFW_EVENT_TYPE_MOUSE_BUTTON_INPUT_BIT))) vkfwReleaseAllActions(window[0].actionMap);
+    window[0].disabledEventTypes = disabledEventTypes;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwUpdateGamepadMappingsUntimed(VkfwInstance instance, uint32_t mappingCount, const VkfwGamepadMapping* mappings) {
     /* this is currently unimplemented, it would be better to connect it to GLFW internals directly, or possibly reverse that internal function, since passing the string seems unncessarily complicated */
     return VKFW_ERROR_FEATURE_NOT_SUPPORTED;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoysticks(VkfwInstance instance, uint32_t* pJoystickCount, VkfwJoystick* pJoysticks) {
+static VkfwResult vkfwEnumerateJoysticksUntimed(VkfwInstance instance, uint32_t* pJoystickCount, VkfwJoystick* pJoysticks) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
     if(pJoystickCount == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
 
-    uint32_t count;
+    uint32_t count = 0;
     int jid;
     
     for(jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; jid++) {
@@ -1626,7 +4398,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoysticks(VkfwInstance insta
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoystickProperties(VkfwJoystick joystick, VkfwJoystickProperties* pProperties) {
+static VkfwResult vkfwEnumerateJoystickPropertiesUntimed(VkfwJoystick joystick, VkfwJoystickProperties* pProperties) {
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if((int32_t) joystick < GLFW_JOYSTICK_1 || (int32_t) joystick > GLFW_JOYSTICK_LAST) return VKFW_ERROR_INVALID_HANDLE;
     if(pProperties == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
@@ -1652,26 +4424,29 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoystickProperties(VkfwJoyst
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
-    pProperties[0].name = glfwGetJoystickName(underlyingJoystickID);
+    const char* joystickName = glfwGetJoystickName(underlyingJoystickID);
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
-    pProperties[0].GUID = glfwGetJoystickGUID(underlyingJoystickID);
+    if(vkfwCopyStringToScratch(joystickName, &pProperties[0].name) != VKFW_SUCCESS) return VKFW_ERROR_OUT_OF_MEMORY;
+    const char* joystickGUID = glfwGetJoystickGUID(underlyingJoystickID);
     switch(glfwGetError(NULL)) {
         case GLFW_NO_ERROR: break;
         case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
         default: return VKFW_ERROR_UNKNOWN;
     }
+    if(vkfwCopyStringToScratch(joystickGUID, &pProperties[0].GUID) != VKFW_SUCCESS) return VKFW_ERROR_OUT_OF_MEMORY;
     switch(glfwJoystickIsGamepad(underlyingJoystickID)) {
         case GLFW_TRUE: pProperties[0].isGamepad = VKFW_TRUE; break;
         case GLFW_FALSE: pProperties[0].isGamepad = VKFW_FALSE; break;
         default: return VKFW_ERROR_UNKNOWN;
     }
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
-    pProperties[0].gamepadName = glfwGetGamepadName(underlyingJoystickID);
+    const char* gamepadName = glfwGetGamepadName(underlyingJoystickID);
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    if(vkfwCopyStringToScratch(gamepadName, &pProperties[0].gamepadName) != VKFW_SUCCESS) return VKFW_ERROR_OUT_OF_MEMORY;
     pProperties[0].gamepadStateRetrievalSuccessfull = glfwGetGamepadState(underlyingJoystickID, (GLFWgamepadstate *) &pProperties[0].gamepadState);
     if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
     pProperties[0].userPointer = glfwGetJoystickUserPointer(underlyingJoystickID);
@@ -1679,7 +4454,7 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoystickProperties(VkfwJoyst
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetJoystickUserPointer(VkfwJoystick joystick, void* pUserPointer) {    
+static VkfwResult vkfwSetJoystickUserPointerUntimed(VkfwJoystick joystick, void* pUserPointer) {    
     if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
     if((int32_t) joystick < GLFW_JOYSTICK_1 || (int32_t) joystick > GLFW_JOYSTICK_LAST) return VKFW_ERROR_INVALID_HANDLE;
     
@@ -1690,12 +4465,253 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetJoystickUserPointer(VkfwJoystick j
     
     return VKFW_SUCCESS;
 }
-VKFWAPI_ATTR VkfwVkBool32 VKFWAPI_CALL vkfwVkGetPhysicalDevicePresentationSupport(VkfwVkInstance instance, VkfwVkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) {
+static VkfwResult vkfwSetJoystickSamplingRateUntimed(VkfwInstance instance, uint32_t samplesPerSecond) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    
+    int jid;
+    
+    if(samplesPerSecond > timerFrequency) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    
+    /* the samples after a pause start a new run, the reader skips what is left of the old one */
+    for(jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; jid++) joystickSampleRings[jid].connected = VKFW_FALSE;
+    if(samplesPerSecond == 0) {
+        joystickSamplingPeriod = 0;
+        return VKFW_SUCCESS;
+    }
+    
+    joystickSamplingPeriod = timerFrequency / samplesPerSecond;
+    joystickNextSampleTime = glfwGetTimerValue();
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwSampleJoysticksUntimed(VkfwInstance instance) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(joystickSamplingPeriod == 0) return VKFW_ERROR_FEATURE_NOT_SUPPORTED; /* sampling has to be enabled with vkfwSetJoystickSamplingRate first */
+    
+    uint64_t now = glfwGetTimerValue();
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    
+    return vkfwProcessTimers(now);
+}
+static VkfwResult vkfwReadJoystickSamplesUntimed(VkfwJoystick joystick, uint32_t* pSampleCount, VkfwJoystickSample* pSamples) {
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if((int32_t) joystick < GLFW_JOYSTICK_1 || (int32_t) joystick > GLFW_JOYSTICK_LAST) return VKFW_ERROR_INVALID_HANDLE;
+    if(pSampleCount == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    uint32_t i;
+    
+    VkfwJoystickSampleRing* ring = &joystickSampleRings[(int32_t) joystick];
+    uint32_t head = atomic_load_explicit(&ring[0].head, memory_order_acquire);
+    uint32_t first = atomic_load_explicit(&ring[0].first, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring[0].tail, memory_order_relaxed);
+    if(head - tail > head - first) tail = first; /* the samples before first are from a previous connection */
+    if(head - tail > VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH) tail = head - VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH; /* overwritten already */
+    uint32_t availableSampleCount = head - tail;
+    
+    if(pSamples == NULL) {
+        pSampleCount[0] = availableSampleCount;
+        return VKFW_SUCCESS;
+    }
+    
+    uint32_t sampleCount = (pSampleCount[0] < availableSampleCount) ? pSampleCount[0] : availableSampleCount;
+    for(i = 0; i < sampleCount; i++) {
+        vkfwLoadJoystickSample(ring[0].sampleWords[(tail + i) % VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH], &pSamples[i]);
+    }
+    
+    /* the oldest copied samples may have been overwritten while they were copied, then they are dropped like the ones overwritten before */
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t writing = atomic_load_explicit(&ring[0].writing, memory_order_relaxed);
+    if(writing - tail > VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH) {
+        uint32_t overwrittenCount = writing - VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH - tail;
+        if(overwrittenCount > sampleCount) overwrittenCount = sampleCount;
+        memmove(pSamples, pSamples + overwrittenCount, sizeof(VkfwJoystickSample) * (sampleCount - overwrittenCount));
+        sampleCount -= overwrittenCount;
+        tail += overwrittenCount;
+    }
+    
+    pSampleCount[0] = sampleCount;
+    atomic_store_explicit(&ring[0].tail, tail + sampleCount, memory_order_relaxed);
+    
+    return VKFW_SUCCESS;
+}
+static VkfwVkBool32 vkfwVkGetPhysicalDevicePresentationSupportUntimed(VkfwVkInstance instance, VkfwVkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) {
+    int glfwError;
     /* since we need to return the same value, we cannot return an error code here on GLFW error, we hope it fails successfully by the original return value */
-    return glfwGetPhysicalDevicePresentationSupport(instance, physicalDevice, queueFamilyIndex);
+    return vkfwGetPresentationSupport(instance, physicalDevice, queueFamilyIndex, &glfwError);
 }
-VKFWAPI_ATTR VkfwVkResult VKFWAPI_CALL vkfwVkCreateWindowSurface(VkfwVkInstance instance, VkfwWindow window, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurface) {
+static VkfwVkResult vkfwVkCreateWindowSurfaceUntimed(VkfwVkInstance instance, VkfwWindow window, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurface) {
+    /* since we need to return a VkResult, invalid handles are reported the way the driver would report a surface it cannot create */
+    if(window == NULL) return VK_ERROR_INITIALIZATION_FAILED;
+    if(window[0].windowHandle == NULL) return VK_ERROR_INITIALIZATION_FAILED;
+    if(pSurface == NULL) return VK_ERROR_INITIALIZATION_FAILED;
+    
     /* since we need to return the same value, we cannot return an error code here on GLFW error, we hope it fails successfully by the original return value */
-    return glfwCreateWindowSurface(instance, window[0].windowHandle, pAllocator, pSurface);
+    return vkfwCreateSurface(vkfwFindVulkanInstanceFunctions(instance), instance, window, pAllocator, pSurface);
+}
+static VkfwResult vkfwVkGetPhysicalDevicesPresentationSupportUntimed(VkfwVkInstance instance, uint32_t physicalDeviceCount, const VkfwVkPhysicalDevice* pPhysicalDevices, const uint32_t* pQueueFamilyCounts, uint64_t* pSupportMasks) {
+    uint32_t i, j;
+    int glfwError;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance == VK_NULL_HANDLE) return VKFW_ERROR_INVALID_HANDLE;
+    if(physicalDeviceCount == 0) return VKFW_SUCCESS;
+    if(pPhysicalDevices == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pQueueFamilyCounts == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pSupportMasks == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    for(i = 0; i < physicalDeviceCount; i++) {
+        if(pPhysicalDevices[i] == VK_NULL_HANDLE) return VKFW_ERROR_INVALID_HANDLE;
+        if(pQueueFamilyCounts[i] > VKFW_PRESENTATION_SUPPORT_CACHED_FAMILIES) return VKFW_ERROR_INVALID_NUMERIC_VALUE; /* doesn't fit into the mask */
+    }
+    
+    for(i = 0; i < physicalDeviceCount; i++) {
+        pSupportMasks[i] = 0;
+        for(j = 0; j < pQueueFamilyCounts[i]; j++) {
+            if(vkfwGetPresentationSupport(instance, pPhysicalDevices[i], j, &glfwError)) pSupportMasks[i] |= (uint64_t) 1 << j;
+            switch(glfwError) {
+                case GLFW_NO_ERROR: break;
+                case GLFW_API_UNAVAILABLE: return VKFW_ERROR_API_UNAVAILABLE;
+                case GLFW_PLATFORM_ERROR: return VKFW_ERROR_PLATFORM_ERROR;
+                default: return VKFW_ERROR_UNKNOWN;
+            }
+        }
+    }
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwLoadVulkanInstanceFunctionsUntimed(VkfwInstance instance, VkfwVkInstance vulkanInstance) {
+    uint32_t i;
+    VkfwVulkanInstanceFunctions* pFunctions = NULL;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(vulkanInstance == VK_NULL_HANDLE) return VKFW_ERROR_INVALID_HANDLE;
+    
+    if(!glfwVulkanSupported()) {
+        switch(glfwGetError(NULL)) {
+            case GLFW_NO_ERROR: return VKFW_ERROR_API_UNAVAILABLE;
+            default: return VKFW_ERROR_UNKNOWN;
+        }
+    }
+    
+    for(i = 0; i < VKFW_VULKAN_INSTANCE_FUNCTION_TABLE_COUNT && pFunctions == NULL; i++) {
+        if(vulkanInstanceFunctions[i].instance == vulkanInstance) pFunctions = &vulkanInstanceFunctions[i];
+    }
+    for(i = 0; i < VKFW_VULKAN_INSTANCE_FUNCTION_TABLE_COUNT && pFunctions == NULL; i++) {
+        if(vulkanInstanceFunctions[i].instance == VK_NULL_HANDLE) pFunctions = &vulkanInstanceFunctions[i];
+    }
+    if(pFunctions == NULL) return VKFW_ERROR_OUT_OF_MEMORY; /* all tables are in use */
+    
+    /* the loader VKFW was created with, or the one GLFW found */
+    PFN_vkGetInstanceProcAddr loader = desiredVulkanLoader;
+    if(loader == NULL) loader = (PFN_vkGetInstanceProcAddr) glfwGetInstanceProcAddress(VK_NULL_HANDLE, "vkGetInstanceProcAddr");
+    if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    if(loader == NULL) return VKFW_ERROR_API_UNAVAILABLE;
+    
+    /* the loader may return functions of extensions the instance wasn't created with, so only the ones of the platform surface extension
+       are loaded, and on X11 only the ones of the extension glfwGetRequiredInstanceExtensions names: the one glfwCreateWindowSurface uses */
+    memset(pFunctions, 0, sizeof(VkfwVulkanInstanceFunctions));
+    pFunctions[0].vkGetInstanceProcAddr = loader;
+#if defined(VKFW_EXPOSE_NATIVE_WIN32)
+    pFunctions[0].vkCreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) loader(vulkanInstance, "vkCreateWin32SurfaceKHR");
+    pFunctions[0].vkGetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) loader(vulkanInstance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_WAYLAND)
+    pFunctions[0].vkCreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) loader(vulkanInstance, "vkCreateWaylandSurfaceKHR");
+    pFunctions[0].vkGetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) loader(vulkanInstance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+#endif
+#if defined(VKFW_EXPOSE_NATIVE_X11)
+    if(glfwGetPlatform() == GLFW_PLATFORM_X11) {
+        uint32_t requiredExtensionCount = 0;
+        const char** requiredExtensions = glfwGetRequiredInstanceExtensions(&requiredExtensionCount);
+        for(i = 0; i < requiredExtensionCount; i++) {
+            if(strcmp(requiredExtensions[i], VK_KHR_XCB_SURFACE_EXTENSION_NAME) == 0) {
+                pFunctions[0].vkCreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) loader(vulkanInstance, "vkCreateXcbSurfaceKHR");
+                pFunctions[0].vkGetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) loader(vulkanInstance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+            }
+            if(strcmp(requiredExtensions[i], VK_KHR_XLIB_SURFACE_EXTENSION_NAME) == 0) {
+                pFunctions[0].vkCreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) loader(vulkanInstance, "vkCreateXlibSurfaceKHR");
+                pFunctions[0].vkGetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) loader(vulkanInstance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+            }
+        }
+        if(glfwGetError(NULL)) return VKFW_ERROR_UNKNOWN;
+    }
+#endif
+    pFunctions[0].instance = vulkanInstance;
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwUnloadVulkanInstanceFunctionsUntimed(VkfwInstance instance, VkfwVkInstance vulkanInstance) {
+    uint32_t i;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance != (VkfwInstance) &instanceHandleAddress) return VKFW_ERROR_INVALID_HANDLE;
+    if(vulkanInstance == VK_NULL_HANDLE) return VKFW_ERROR_INVALID_HANDLE;
+    
+    for(i = 0; i < VKFW_VULKAN_INSTANCE_FUNCTION_TABLE_COUNT; i++) {
+        if(vulkanInstanceFunctions[i].instance == vulkanInstance) memset(&vulkanInstanceFunctions[i], 0, sizeof(VkfwVulkanInstanceFunctions));
+    }
+    /* the VkInstance is about to be destroyed, and its handle value may come back for another one */
+    vkfwForgetPresentationSupport(vulkanInstance);
+    
+    return VKFW_SUCCESS;
+}
+static VkfwResult vkfwVkCreateWindowSurfacesUntimed(VkfwVkInstance instance, uint32_t windowCount, const VkfwWindow* pWindows, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurfaces, VkfwVkResult* pResults) {
+    uint32_t i;
+    const VkfwVulkanInstanceFunctions* pFunctions;
+    
+    if(!vfkwInstanceInitialized) return VKFW_ERROR_INITIALIZATION_FAILED;
+    if(instance == VK_NULL_HANDLE) return VKFW_ERROR_INVALID_HANDLE;
+    if(windowCount == 0) return VKFW_SUCCESS;
+    if(pWindows == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pSurfaces == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    if(pResults == NULL) return VKFW_ERROR_INVALID_POINTER_VALUE;
+    
+    /* all handles are checked before the first surface is created, so that nothing needs to be destroyed again */
+    for(i = 0; i < windowCount; i++) {
+        if(pWindows[i] == NULL) return VKFW_ERROR_INVALID_HANDLE;
+        if(pWindows[i][0].monitorHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+        if(pWindows[i][0].windowHandle == NULL) return VKFW_ERROR_INVALID_HANDLE;
+    }
+    
+    pFunctions = vkfwFindVulkanInstanceFunctions(instance);
+    for(i = 0; i < windowCount; i++) {
+        pSurfaces[i] = VK_NULL_HANDLE;
+        pResults[i] = vkfwCreateSurface(pFunctions, instance, pWindows[i], pAllocator, &pSurfaces[i]);
+        glfwGetError(NULL); /* a failed window must not leave its GLFW error to the next one, its VkResult says enough */
+    }
+    
+    return VKFW_SUCCESS;
+}
+/* the window an entry point is about is its first parameter, if that is a VkfwWindow. the extra expansion is for the MSVC preprocessor. */
+#define VKFW_EXPAND(x) x
+#define VKFW_FIRST_ARGUMENT(first, ...) first
+#define VKFW_TRACED_WINDOW(...) _Generic((VKFW_EXPAND(VKFW_FIRST_ARGUMENT(__VA_ARGS__, 0))), VkfwWindow: (VKFW_EXPAND(VKFW_FIRST_ARGUMENT(__VA_ARGS__, 0))), default: (VkfwWindow) NULL)
+
+#define VKFW_TIMED_ENTRY_POINT(returnType, name, subsystem, parameters, arguments)                             \
+VKFWAPI_ATTR returnType VKFWAPI_CALL name parameters {                                               \
+    if(!atomic_load_explicit(&entryPointTrackingEnabled, memory_order_relaxed)) return name##Untimed arguments; \
+    uint32_t outerEntryPoint = currentEntryPoint;                                                    \
+    currentEntryPoint = VKFW_ENTRY_POINT_INDEX_##name;                                               \
+    VkfwBool32 instrumented = atomic_load_explicit(&instrumentationEnabled, memory_order_relaxed);   \
+    if(instrumented) {                                                                               \
+        atomic_fetch_add(&instrumentedCallCount, 1);                                                 \
+        instrumented = atomic_load(&instrumentationEnabled);                                         \
+        if(!instrumented) atomic_fetch_sub(&instrumentedCallCount, 1); /* lost the race with vkfwDestroyInstance */ \
+    }                                                                                                \
+    VkfwBool32 statistics = instrumented && atomic_load_explicit(&statisticsEnabled, memory_order_relaxed); \
+    VkfwBool32 trace = instrumented && atomic_load_explicit(&traceEnabled, memory_order_relaxed);    \
+    uint64_t windowSerial = trace ? vkfwGetWindowSerial(VKFW_TRACED_WINDOW arguments) : 0; /* before the call, which may destroy the window */ \
+    uint64_t startTimestamp = instrumented ? vkfwGetTimestamp() : 0; /* allocation tracking alone only needs the current entry point */ \
+    returnType result = name##Untimed arguments;                                                     \
+    if(statistics) vkfwRecordEntryPoint(VKFW_ENTRY_POINT_INDEX_##name, startTimestamp);              \
+    if(trace) vkfwRecordTraceEvent(VKFW_TRACE_EVENT_API, #name, windowSerial, startTimestamp);       \
+    if(instrumented) atomic_fetch_sub(&instrumentedCallCount, 1);                                    \
+    currentEntryPoint = outerEntryPoint;                                                             \
+    return result;                                                                                   \
 }
+VKFW_TIMED_ENTRY_POINTS(VKFW_TIMED_ENTRY_POINT)
 
@@ -50,16 +50,26 @@ extern "C" {
 #define VKFW_TRUE                   1U
 #define VKFW_DONT_CARE              -1
 
+#define VKFW_JOYSTICK_SAMPLE_MAX_AXES           16
+#define VKFW_JOYSTICK_SAMPLE_MAX_BUTTONS        32
+#define VKFW_JOYSTICK_SAMPLE_MAX_HATS           4
+#define VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH     128
+#define VKFW_FRAME_CLOCK_HISTORY_LENGTH         128
+#define VKFW_LATENCY_HISTOGRAM_BUCKET_COUNT     32
+#define VKFW_ALLOCATION_SUBSYSTEM_COUNT         7
+#define VKFW_ACTION_MAP_MAX_ACTIONS             65535
+
 
 typedef uint32_t VkfwFlags;
 typedef uint32_t VkfwBool32;
 
 typedef struct VkfwInstance_t* VkfwInstance;
-/* the other four are direct matches of corresponding GLFW types. If this gets changed at some point, VkfwJoystick can also become a true handle */
+/* monitors and joysticks are direct matches of corresponding GLFW types, windows and cursors are wrapped. If this gets changed at some point, VkfwJoystick can also become a true handle */
 typedef struct VkfwMonitor_t* VkfwMonitor;
 typedef int32_t VkfwJoystick;
 typedef struct VkfwWindow_t* VkfwWindow;
 typedef struct VkfwCursor_t* VkfwCursor;
+typedef struct VkfwActionMap_t* VkfwActionMap;
 
 /* Vulkan Mappings */
 #if defined(VK_VERSION_1_0)
@@ -111,6 +121,7 @@ typedef enum VkfwStructureType {
     VKFW_STRUCTURE_TYPE_INSTANCE_CREATE_INFO            = 0,
     VKFW_STRUCTURE_TYPE_WINDOW_CREATE_INFO              = 1,
     VKFW_STRUCTURE_TYPE_CURSOR_CREATE_INFO              = 2,
+    VKFW_STRUCTURE_TYPE_ACTION_MAP_CREATE_INFO          = 3,
 
     VKFW_STRUCTURE_TYPE_MAX_ENUM                        = 0x7FFFFFFF
 } VkfwStructureType;
@@ -363,10 +374,34 @@ typedef enum VkfwInstancePlatform {
     VKFW_INSTANCE_PLATFORM_MAX_ENUM      = 0x7FFFFFFF
 } VkfwInstancePlatform;
 typedef VkfwFlags VkfwInstancePlatformMask;
+typedef enum VkfwTimestampSource {
+    VKFW_TIMESTAMP_SOURCE_TIMER             = 0x00080001, /* the timer of vkfwGetTimerValue, read directly where possible */
+    VKFW_TIMESTAMP_SOURCE_CPU_COUNTER       = 0x00080002, /* the invariant time stamp counter of x86 CPUs, calibrated when selected */
+    VKFW_TIMESTAMP_SOURCE_MAX_ENUM          = 0x7FFFFFFF
+} VkfwTimestampSource;
+typedef enum VkfwAllocationSubsystem {
+    VKFW_ALLOCATION_SUBSYSTEM_INTERNAL      = 0x00090000, /* everything not attributable to one of the others, like the allocations of GLFW during its initialization */
+    VKFW_ALLOCATION_SUBSYSTEM_WINDOW        = 0x00090001,
+    VKFW_ALLOCATION_SUBSYSTEM_MONITOR       = 0x00090002,
+    VKFW_ALLOCATION_SUBSYSTEM_JOYSTICK      = 0x00090003,
+    VKFW_ALLOCATION_SUBSYSTEM_CURSOR        = 0x00090004,
+    VKFW_ALLOCATION_SUBSYSTEM_CLIPBOARD     = 0x00090005,
+    VKFW_ALLOCATION_SUBSYSTEM_ACTION_MAP    = 0x00090006,
+    VKFW_ALLOCATION_SUBSYSTEM_MAX_ENUM      = 0x7FFFFFFF
+} VkfwAllocationSubsystem;
+typedef enum VkfwInputDevice {
+    VKFW_INPUT_DEVICE_KEYBOARD          = 0x000A0001, /* codes are VkfwKey */
+    VKFW_INPUT_DEVICE_MOUSE             = 0x000A0002, /* codes are VkfwMouseButton */
+    VKFW_INPUT_DEVICE_GAMEPAD           = 0x000A0003, /* codes are VkfwGamepadButton, of any connected gamepad */
+    VKFW_INPUT_DEVICE_MAX_ENUM          = 0x7FFFFFFF
+} VkfwInputDevice;
 
 typedef enum VkfwInstanceCreateFlagBits {
     VKFW_INSTANCE_CREATE_DEFAULTS                                   = 0,
     VKFW_INSTANCE_CREATE_DISABLE_JOYSTICK_HAT_BUTTONS_BIT           = 0x00000001,
+    VKFW_INSTANCE_CREATE_ENABLE_STATISTICS_BIT                      = 0x00000002, /* records the calls of the entry points, see vkfwGetInstanceStatistics */
+    VKFW_INSTANCE_CREATE_ENABLE_TRACE_BIT                           = 0x00000004, /* records the calls and callbacks as a timeline, see vkfwFlushTrace */
+    VKFW_INSTANCE_CREATE_ENABLE_ALLOCATION_TRACKING_BIT             = 0x00000008, /* counts the allocations of VKFW and GLFW, see vkfwGetAllocationStatistics */
     VKFW_INSTANCE_CREATE_WAYLAND_DISABLE_LIBDECOR_BIT_WL            = 0x00001000,
     VKFW_INSTANCE_CREATE_X11_DISABLE_XCB_VULKAN_SURFACE_BIT_X11     = 0x00002000,
     VKFW_INSTANCE_CREATE_COCOA_DISABLE_MENUBAR_BIT_COCOA            = 0x00004000,
@@ -388,7 +423,34 @@ typedef enum VkfwWindowCreateFlagBits {
     VKFW_WINDOW_CREATE_FLAG_BITS_MAX_ENUM                   = 0x7FFFFFFF
 } VkfwWindowCreateFlagBits;
 typedef VkfwFlags VkfwWindowCreateFlags;
+typedef enum VkfwCursorCreateFlagBits {
+    VKFW_CURSOR_CREATE_DEFAULTS                             = 0,
+    VKFW_CURSOR_CREATE_SCALE_WITH_CONTENT_BIT               = 0x0001, /* the custom image is a high resolution source, downscaled to the content scale of each window the cursor is set on; a variant for a new content scale is created by the next vkfwProcessEvents, the closest existing one is shown until then */
+    VKFW_CURSOR_CREATE_FLAG_BITS_MAX_ENUM                   = 0x7FFFFFFF
+} VkfwCursorCreateFlagBits;
 typedef VkfwFlags VkfwCursorCreateFlags;
+typedef VkfwFlags VkfwActionMapCreateFlags; /* reserved */
+typedef enum VkfwEventTypeFlagBits {
+    VKFW_EVENT_TYPE_POSITION_CHANGE_BIT                         = 0x0001,
+    VKFW_EVENT_TYPE_SIZE_CHANGE_BIT                             = 0x0002,
+    VKFW_EVENT_TYPE_FRAMEBUFFER_SIZE_CHANGE_BIT                 = 0x0004, /* also framebufferExtentSettled and the extent of vkfwGetWindowFramebufferExtent */
+    VKFW_EVENT_TYPE_CONTENT_SCALE_CHANGE_BIT                    = 0x0008, /* also resizing cursors created with VKFW_CURSOR_CREATE_SCALE_WITH_CONTENT_BIT */
+    VKFW_EVENT_TYPE_CURSOR_POSITION_CHANGE_BIT                  = 0x0010,
+    VKFW_EVENT_TYPE_FOCUS_CHANGE_BIT                            = 0x0020, /* also noticing keyboard layout changes for the key names */
+    VKFW_EVENT_TYPE_ICONIFICATION_CHANGE_BIT                    = 0x0040,
+    VKFW_EVENT_TYPE_MAXIMIZATION_CHANGE_BIT                     = 0x0080,
+    VKFW_EVENT_TYPE_CLOSE_BUTTON_CLICKED_BIT                    = 0x0100,
+    VKFW_EVENT_TYPE_CONTENT_AREA_NEEDS_TO_BE_REDRAWN_BIT        = 0x0200,
+    VKFW_EVENT_TYPE_PATH_DROP_BIT                               = 0x0400,
+    VKFW_EVENT_TYPE_MOUSE_BUTTON_INPUT_BIT                      = 0x0800, /* also the mouse buttons of the action map */
+    VKFW_EVENT_TYPE_SCROLL_INPUT_BIT                            = 0x1000,
+    VKFW_EVENT_TYPE_CURSOR_ENTER_OR_LEAVE_CONTENT_AREA_BIT      = 0x2000,
+    VKFW_EVENT_TYPE_KEY_INPUT_BIT                               = 0x4000, /* also the keys of the action map */
+    VKFW_EVENT_TYPE_CHARACTER_INPUT_BIT                         = 0x8000, /* both unicode character callbacks and textInput */
+    VKFW_EVENT_TYPE_ALL                                         = 0xFFFF,
+    VKFW_EVENT_TYPE_FLAG_BITS_MAX_ENUM                          = 0x7FFFFFFF
+} VkfwEventTypeFlagBits;
+typedef VkfwFlags VkfwEventTypeFlags;
 
 typedef struct VkfwVideoMode {
     /* width/height in screen coordinates */
@@ -502,6 +564,58 @@ typedef struct VkfwJoystickProperties {
     VkfwBool32              gamepadStateRetrievalSuccessfull;
     void*                   userPointer;
 } VkfwJoystickProperties;
+/* taken at the rate set by vkfwSetJoystickSamplingRate during vkfwProcessEvents and vkfwSampleJoysticks, since GLFW only allows joystick access from the main thread.
+   vkfwReadJoystickSamples drains them, oldest first, and may be called from one other thread. the last VKFW_JOYSTICK_SAMPLE_HISTORY_LENGTH samples
+   are kept, older ones are overwritten; samples from before the joystick was last connected or sampling was last enabled are not returned. */
+typedef struct VkfwJoystickSample {
+    uint64_t                timestamp; /* in timer ticks, see vkfwGetTimerValue */
+    /* the counts are clamped to the VKFW_JOYSTICK_SAMPLE_MAX_* values */
+    uint32_t                axesCount;
+    float                   axesStates[VKFW_JOYSTICK_SAMPLE_MAX_AXES];
+    uint32_t                buttonCount;
+    uint8_t                 buttonStates[VKFW_JOYSTICK_SAMPLE_MAX_BUTTONS]; /* see enum VkfwAction */
+    uint32_t                hatCount;
+    uint8_t                 hatStates[VKFW_JOYSTICK_SAMPLE_MAX_HATS]; /* see enum VkfwJoystickHatState */
+    VkfwBool32              isGamepad;
+    VkfwGamepadInputState   gamepadState; /* only valid if isGamepad is set */
+} VkfwJoystickSample;
+/* frame time statistics, kept in place without allocations. reset it with vkfwResetFrameClock and call vkfwTickFrameClock once per frame. */
+typedef struct VkfwFrameClock {
+    uint64_t                timestampFrequency; /* of the timestamp source at the reset */
+    uint64_t                previousTimestamp;
+    uint64_t                frameCount; /* ticks since the reset */
+    double                  delta; /* seconds between the last two ticks */
+    double                  smoothedDelta; /* exponential moving average of delta */
+    double                  smoothingFactor; /* the weight of a new delta in smoothedDelta, 0.1 after the reset */
+    float                   deltaHistory[VKFW_FRAME_CLOCK_HISTORY_LENGTH]; /* seconds, indexed by frameCount modulo the length, see vkfwGetFrameClockPercentile */
+} VkfwFrameClock;
+/* the calls of one entry point on all threads. the times include the GLFW calls and the entry points called from within it, like from callbacks;
+   bench/vkfw_bench.c compares them against doing the same with GLFW directly. */
+typedef struct VkfwEntryPointStatistics {
+    const char*             name;
+    uint64_t                callCount;
+    uint64_t                totalNanoseconds;
+    uint64_t                latencyHistogram[VKFW_LATENCY_HISTOGRAM_BUCKET_COUNT]; /* bucket i counts calls taking 2^i to 2^(i+1) nanoseconds, the first and last are open ended */
+} VkfwEntryPointStatistics;
+typedef struct VkfwStatistics {
+    uint32_t                    entryPointCount; /* the capacity of pEntryPoints, set to the number written; or to the number of entry points if pEntryPoints is NULL */
+    VkfwEntryPointStatistics*   pEntryPoints;
+} VkfwStatistics;
+/* a frame is the time between the starts of two event processings, reallocations count as an allocation */
+typedef struct VkfwAllocationCounters {
+    uint64_t                allocationCount;
+    uint64_t                freeCount;
+    uint64_t                allocatedBytes;
+    uint64_t                liveBytes;
+    uint64_t                peakLiveBytes;
+    uint64_t                previousFrameAllocationCount;
+    uint64_t                previousFrameAllocatedBytes;
+} VkfwAllocationCounters;
+typedef struct VkfwAllocationStatistics {
+    VkfwAllocationCounters  subsystems[VKFW_ALLOCATION_SUBSYSTEM_COUNT]; /* indexed by the subsystem minus VKFW_ALLOCATION_SUBSYSTEM_INTERNAL */
+    VkfwAllocationCounters  total; /* the peak of all subsystems together, not the sum of their peaks */
+    uint64_t                frameCount;
+} VkfwAllocationStatistics;
 typedef struct VkfwWindowState {
     /* 15 flags; can be combined into 1 uint16_t, reducing the struct by 58 bytes to ~64 bytes from ca 120 bytes, almost halving it. */
     VkfwBool32      fullscreen; /* with this off, the monitor is curently ignored, but one could move the window to the monitor in windowed mode on certain platforms */
@@ -555,38 +669,59 @@ typedef struct VkfwAllocationCallbacks {
     PFN_vkfwFreeFunction                      pfnFree;
 } VkfwAllocationCallbacks;
 
-typedef void (* VkfwInstanceMonitorConnectionCallback)(VkfwMonitor monitor, VkfwConnectionEvent event);
-typedef void (* VkfwInstanceJoystickConnectionCallback)(VkfwJoystick jid, VkfwConnectionEvent event);
+typedef void (* VkfwInstanceMonitorConnectionCallback)(VkfwMonitor monitor, VkfwConnectionEvent event, void* pUserData);
+typedef void (* VkfwInstanceJoystickConnectionCallback)(VkfwJoystick jid, VkfwConnectionEvent event, void* pUserData);
+/* the joystick and gamepad input callbacks are generated by comparing the joystick state between event processing and sampling (see vkfwSetJoystickSamplingRate) */
+typedef void (* VkfwInstanceJoystickButtonChangeCallback)(VkfwJoystick jid, uint32_t button, VkfwAction action, uint64_t timestamp, void* pUserData);
+typedef void (* VkfwInstanceJoystickHatChangeCallback)(VkfwJoystick jid, uint32_t hat, VkfwJoystickHatState state, uint64_t timestamp, void* pUserData);
+typedef void (* VkfwInstanceJoystickAxisChangeCallback)(VkfwJoystick jid, uint32_t axis, float value, uint64_t timestamp, void* pUserData);
+typedef void (* VkfwInstanceGamepadButtonChangeCallback)(VkfwJoystick jid, VkfwGamepadButton button, VkfwAction action, uint64_t timestamp, void* pUserData);
+typedef void (* VkfwInstanceGamepadAxisChangeCallback)(VkfwJoystick jid, VkfwGamepadAxis axis, float value, uint64_t timestamp, void* pUserData);
 
+/* pUserData is passed to all of the callbacks in the struct */
 typedef struct VkfwInstanceCallbacks {
-    VkfwInstanceMonitorConnectionCallback   monitorConnection;
-    VkfwInstanceJoystickConnectionCallback  joystickConnection;
+    void*                                       pUserData;
+    VkfwInstanceMonitorConnectionCallback       monitorConnection;
+    VkfwInstanceJoystickConnectionCallback      joystickConnection;
+    VkfwInstanceJoystickButtonChangeCallback    joystickButtonChange;
+    VkfwInstanceJoystickHatChangeCallback       joystickHatChange;
+    VkfwInstanceJoystickAxisChangeCallback      joystickAxisChange;
+    VkfwInstanceGamepadButtonChangeCallback     gamepadButtonChange;
+    VkfwInstanceGamepadAxisChangeCallback       gamepadAxisChange;
 } VkfwInstanceCallbacks;
 
-typedef void (* VkfwWindowPositionChangeCallback)                       (VkfwWindow window, int32_t xPosition, int32_t yPosition);
-typedef void (* VkfwWindowSizeChangeCallback)                           (VkfwWindow window, int32_t width, int32_t height);
-typedef void (* VkfwWindowFramebufferSizeChangeCallback)                (VkfwWindow window, int32_t width, int32_t height);
-typedef void (* VkfwWindowContentScaleChangeCallback)                   (VkfwWindow window, float xScale, float yScale);
-typedef void (* VkfwWindowCursorPositionChangeCallback)                 (VkfwWindow window, double xPosition, double yPosition);
-typedef void (* VkfwWindowFocusChangeCallback)                          (VkfwWindow window, VkfwBool32 focused);
-typedef void (* VkfwWindowIconficationChangeCallback)                   (VkfwWindow window, VkfwBool32 iconified);
-typedef void (* VkfwWindowMaximizationChangeCallback)                   (VkfwWindow window, VkfwBool32 maximized);
-
-typedef void (* VkfwWindowCloseButtonClickedCallback)                   (VkfwWindow window);
-typedef void (* VkfwWindowContentAreaNeedsToBeRedrawnCallback)          (VkfwWindow window);
-typedef void (* VkfwWindowPathDropCallback)                             (VkfwWindow window, int32_t pathCount, const char** paths);
-
-typedef void (* VkfwWindowMouseButtonInputCallback)                     (VkfwWindow window, VkfwMouseButton button, VkfwAction action, VkfwModifierKeyMask mods);
-typedef void (* VkfwWindowScrollInputCallback)                          (VkfwWindow window, double xAxisOffset, double yAxisOffset);
-typedef void (* VkfwCursorEnterOrLeaveContentAreaCallback)              (VkfwWindow window, VkfwBool32 entered);
-typedef void (* VkfwWindowKeyInputCallback)                             (VkfwWindow window, VkfwKey key, int32_t scancode, VkfwKeyAction action, VkfwModifierKeyMask mods);
-typedef void (* VkfwWindowUnicodeCharacterInputCallback)                (VkfwWindow window, uint32_t codepoint);
-typedef void (* VkfwWindowUnicodeCharacterInputWithModifiersCallback)   (VkfwWindow window, uint32_t codepoint, VkfwModifierKeyMask mods); /* deprecated in GLFW 3.4, to be removed in GLFW 4.0; should VKFW keep it? */
-
+typedef void (* VkfwWindowPositionChangeCallback)                       (VkfwWindow window, int32_t xPosition, int32_t yPosition, void* pUserData);
+typedef void (* VkfwWindowSizeChangeCallback)                           (VkfwWindow window, int32_t width, int32_t height, void* pUserData);
+typedef void (* VkfwWindowFramebufferSizeChangeCallback)                (VkfwWindow window, int32_t width, int32_t height, void* pUserData);
+typedef void (* VkfwWindowFramebufferExtentSettledCallback)             (VkfwWindow window, VkfwExtent2D extent, uint64_t generation, void* pUserData);
+typedef void (* VkfwWindowContentScaleChangeCallback)                   (VkfwWindow window, float xScale, float yScale, void* pUserData);
+typedef void (* VkfwWindowCursorPositionChangeCallback)                 (VkfwWindow window, double xPosition, double yPosition, void* pUserData);
+typedef void (* VkfwWindowFocusChangeCallback)                          (VkfwWindow window, VkfwBool32 focused, void* pUserData);
+typedef void (* VkfwWindowIconficationChangeCallback)                   (VkfwWindow window, VkfwBool32 iconified, void* pUserData);
+typedef void (* VkfwWindowMaximizationChangeCallback)                   (VkfwWindow window, VkfwBool32 maximized, void* pUserData);
+
+typedef void (* VkfwWindowCloseButtonClickedCallback)                   (VkfwWindow window, void* pUserData);
+typedef void (* VkfwWindowContentAreaNeedsToBeRedrawnCallback)          (VkfwWindow window, void* pUserData);
+typedef void (* VkfwWindowPathDropCallback)                             (VkfwWindow window, int32_t pathCount, const char** paths, void* pUserData);
+
+typedef void (* VkfwWindowMouseButtonInputCallback)                     (VkfwWindow window, VkfwMouseButton button, VkfwAction action, VkfwModifierKeyMask mods, void* pUserData);
+typedef void (* VkfwWindowScrollInputCallback)                          (VkfwWindow window, double xAxisOffset, double yAxisOffset, void* pUserData);
+typedef void (* VkfwCursorEnterOrLeaveContentAreaCallback)              (VkfwWindow window, VkfwBool32 entered, void* pUserData);
+typedef void (* VkfwWindowKeyInputCallback)                             (VkfwWindow window, VkfwKey key, int32_t scancode, VkfwKeyAction action, VkfwModifierKeyMask mods, void* pUserData);
+typedef void (* VkfwWindowUnicodeCharacterInputCallback)                (VkfwWindow window, uint32_t codepoint, void* pUserData);
+typedef void (* VkfwWindowUnicodeCharacterInputWithModifiersCallback)   (VkfwWindow window, uint32_t codepoint, VkfwModifierKeyMask mods, void* pUserData); /* deprecated in GLFW 3.4, to be removed in GLFW 4.0; should VKFW keep it? */
+typedef void (* VkfwWindowTextInputCallback)                            (VkfwWindow window, const char* text, uint32_t byteCount, void* pUserData); /* null terminated UTF-8, only valid during the callback */
+
+/* window is NULL for actions triggered by a gamepad */
+typedef void (* VkfwActionMapEventCallback)                             (VkfwActionMap actionMap, VkfwWindow window, uint32_t action, VkfwAction state, void* pUserData);
+
+/* pUserData is passed to all of the callbacks in the struct, together with the window they are about */
 typedef struct VkfwWindowCallbacks {
+    void*                                                   pUserData;
     VkfwWindowPositionChangeCallback                        positionChange;
     VkfwWindowSizeChangeCallback                            sizeChange;
     VkfwWindowFramebufferSizeChangeCallback                 framebufferSizeChange;
+    VkfwWindowFramebufferExtentSettledCallback              framebufferExtentSettled; /* once per resize, after framebufferSettlePeriod without further size changes */
     VkfwWindowContentScaleChangeCallback                    contentScaleChange;
     VkfwWindowCursorPositionChangeCallback                  cursorPositionChange;
     VkfwWindowFocusChangeCallback                           focusChange;
@@ -603,6 +738,7 @@ typedef struct VkfwWindowCallbacks {
     VkfwWindowKeyInputCallback                              keyInput;
     VkfwWindowUnicodeCharacterInputCallback                 unicodeCharacterInput;
     VkfwWindowUnicodeCharacterInputWithModifiersCallback    unicodeCharacterInputWithModifiers;
+    VkfwWindowTextInputCallback                             textInput; /* the characters of unicodeCharacterInput, collected into one string per event processing */
 } VkfwWindowCallbacks;
 
 
@@ -614,6 +750,7 @@ typedef struct VkfwInstanceCreateInfo {
     VkfwInstancePlatform                    desiredPlatform;
     PFN_vkfwVkGetInstanceProcAddr           desiredVulkanLoader;
     VkfwInstanceCallbacks                   callbacks;
+    float                                   joystickAxisChangeThreshold; /* an axis change callback is only generated once the axis moved further than this from the last reported value */
 } VkfwInstanceCreateInfo;
 
 typedef struct VkfwWindowCreateInfo {
@@ -624,6 +761,9 @@ typedef struct VkfwWindowCreateInfo {
     VkfwWindowState             initialState;
     VkfwVideoMode               requestedVideoMode; /*size has to be the same as in initalState*/
     VkfwWindowCallbacks         callbacks;
+    double                      framebufferSettlePeriod; /* in seconds; 0 settles a resize at the end of the event processing that received it */
+    uint32_t                    textInputBufferSize; /* in bytes, at least 4, 0 for the default of 256; text that doesn't fit is delivered early, in several calls of textInput */
+    VkfwEventTypeFlags          disabledEventTypes; /* see vkfwSetWindowDisabledEventTypes */
 
     const char*                 cocoaFrameName_COCOA;
     const char*                 x11ClassName_X11;
@@ -638,9 +778,33 @@ typedef struct VkfwCursorCreateInfo {
 
     VkfwCursorShape             shape;
     const VkfwImageData*        customCursorImageData;
-    VkfwOffset2D                customCursorHotspotCoordinate;
+    VkfwOffset2D                customCursorHotspotCoordinate; /* with VKFW_CURSOR_CREATE_SCALE_WITH_CONTENT_BIT, relative to the base size */
+    VkfwExtent2D                customCursorBaseSize; /* only used with VKFW_CURSOR_CREATE_SCALE_WITH_CONTENT_BIT: size at a content scale of 1.0, at most the image size */
+    uint32_t                    customCursorFrameCount; /* 0 or 1 for a still cursor, otherwise customCursorImageData points to this many frames of an animation */
+    double                      customCursorFrameDuration; /* in seconds, only used for animated cursors */
 } VkfwCursorCreateInfo;
 
+/* binds an input to an action. modifiers is a combination of shift, control, alt and super that has to be held for the binding to apply;
+   the lock keys are ignored. if several bindings of an input apply, the one requiring the most modifiers wins, so that Ctrl+S can override S. */
+typedef struct VkfwActionBinding {
+    VkfwInputDevice             device;
+    int32_t                     code;
+    VkfwModifierKeyMask         modifiers; /* always VKFW_MODIFIER_KEY_NONE for gamepads */
+    uint32_t                    action; /* less than the action count of the map */
+} VkfwActionBinding;
+
+typedef struct VkfwActionMapCreateInfo {
+    VkfwStructureType           sType;
+    const void*                 pNext;
+    VkfwActionMapCreateFlags    flags;
+
+    uint32_t                    actionCount; /* at most VKFW_ACTION_MAP_MAX_ACTIONS */
+    uint32_t                    bindingCount;
+    const VkfwActionBinding*    pBindings;
+    VkfwActionMapEventCallback  actionEvent; /* once when the first input bound to an action is pressed, and once when the last one is released */
+    void*                       pUserData; /* passed to actionEvent */
+} VkfwActionMapCreateInfo;
+
 
 
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwEnumerateGlobalProperties)(VkfwGlobalProperties* pProperties);
@@ -649,11 +813,24 @@ typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwDestroyInstance)(VkfwInstance instanc
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwEnumerateInstanceProperties)(VkfwInstance instance, VkfwInstanceProperties* pProperties);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetKeyScancode)(VkfwInstance instance, VkfwKey key, int32_t* pScancode);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetKeyName)(VkfwInstance instance, VkfwKey key, int32_t scancode, const char** pKeyName);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetKeyNames)(VkfwInstance instance, uint32_t keyCount, const VkfwKey* pKeys, const char** pKeyNames);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwPostEmptyEvent)(VkfwInstance instance);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwProcessEvents)(VkfwInstance instance, double timeout, VkfwBool32 waitIndefinitely);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwWaitEventsUntil)(VkfwInstance instance, uint64_t deadline);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwProcessEventsBudgeted)(VkfwInstance instance, uint64_t maxTicks, VkfwBool32* pEventsRemaining);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwResetScratch)(VkfwInstance instance);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetClipboardString)(VkfwInstance instance, const char** pClipboardString);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetClipboardString)(VkfwInstance instance, const char* clipboardString);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetTimerValue)(VkfwInstance instance, uint64_t* pTimerValue);
+typedef uint64_t     (VKFWAPI_PTR *PFN_vkfwGetTimestamp)(void);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetTimestampSource)(VkfwInstance instance, VkfwTimestampSource source);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetTimestampFrequency)(VkfwInstance instance, uint64_t* pFrequency);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwResetFrameClock)(VkfwInstance instance, VkfwFrameClock* pFrameClock);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwTickFrameClock)(VkfwFrameClock* pFrameClock);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetFrameClockPercentile)(const VkfwFrameClock* pFrameClock, float percentile, double* pDelta);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetInstanceStatistics)(VkfwInstance instance, VkfwStatistics* pStatistics);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwFlushTrace)(VkfwInstance instance, const char* path);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetAllocationStatistics)(VkfwInstance instance, VkfwAllocationStatistics* pStatistics);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwEnumerateMonitors)(VkfwInstance instance, uint32_t* pMonitorCount, VkfwMonitor* pMonitors);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwEnumerateMonitorProperties)(VkfwMonitor monitor, VkfwMonitorProperties* pProperties);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetMonitorUserPointer)(VkfwMonitor monitor, void* pUserPointer);
@@ -672,12 +849,28 @@ typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetWindowSizeLimits)(VkfwWindow windo
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwCreateCursor)(VkfwInstance instance, const VkfwCursorCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwCursor* pCursor);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwDestroyCursor)(VkfwCursor cursor, const VkfwAllocationCallbacks* pAllocator);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetWindowCursor)(VkfwWindow window, VkfwCursor cursor);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwCreateActionMap)(VkfwInstance instance, const VkfwActionMapCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwActionMap* pActionMap);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwDestroyActionMap)(VkfwActionMap actionMap, const VkfwAllocationCallbacks* pAllocator);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetActionMapBindings)(VkfwActionMap actionMap, uint32_t bindingCount, const VkfwActionBinding* pBindings);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetActionMapState)(VkfwActionMap actionMap, uint64_t* pStateBits);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetWindowActionMap)(VkfwWindow window, VkfwActionMap actionMap);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetWindowDisabledEventTypes)(VkfwWindow window, VkfwEventTypeFlags disabledEventTypes);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwUpdateGamepadMappings)(VkfwInstance instance, uint32_t mappingCount, const VkfwGamepadMapping* mappings);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwEnumerateJoysticks)(VkfwInstance instance, uint32_t* pJoystickCount, VkfwJoystick* pJoysticks);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwEnumerateJoystickProperties)(VkfwJoystick joystick, VkfwJoystickProperties* pProperties);
 typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetJoystickUserPointer)(VkfwJoystick joystick, void* pUserPointer);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetJoystickSamplingRate)(VkfwInstance instance, uint32_t samplesPerSecond);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSampleJoysticks)(VkfwInstance instance);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwReadJoystickSamples)(VkfwJoystick joystick, uint32_t* pSampleCount, VkfwJoystickSample* pSamples);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwSetWindowIconFromImage)(VkfwWindow window, const VkfwImageData* pSourceImage);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetWindowFramebufferExtent)(VkfwWindow window, VkfwExtent2D* pExtent, uint64_t* pGeneration);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwGetWindowNextFrameDeadline)(VkfwWindow window, uint64_t previousDeadline, uint64_t* pDeadline);
 typedef VkfwVkBool32 (VKFWAPI_PTR *PFN_vkfwVkGetPhysicalDevicePresentationSupport)(VkfwVkInstance instance, VkfwVkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex);
 typedef VkfwVkResult (VKFWAPI_PTR *PFN_vkfwVkCreateWindowSurface)(VkfwVkInstance instance, VkfwWindow window, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurface);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwVkGetPhysicalDevicesPresentationSupport)(VkfwVkInstance instance, uint32_t physicalDeviceCount, const VkfwVkPhysicalDevice* pPhysicalDevices, const uint32_t* pQueueFamilyCounts, uint64_t* pSupportMasks);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwLoadVulkanInstanceFunctions)(VkfwInstance instance, VkfwVkInstance vulkanInstance);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwUnloadVulkanInstanceFunctions)(VkfwInstance instance, VkfwVkInstance vulkanInstance);
+typedef VkfwResult   (VKFWAPI_PTR *PFN_vkfwVkCreateWindowSurfaces)(VkfwVkInstance instance, uint32_t windowCount, const VkfwWindow* pWindows, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurfaces, VkfwVkResult* pResults);
 
 
 #ifndef VKFW_NO_PROTOTYPES
@@ -687,16 +880,43 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyInstance(VkfwInstance instance
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateInstanceProperties(VkfwInstance instance, VkfwInstanceProperties* pProperties);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyScancode(VkfwInstance instance, VkfwKey key, int32_t* pScancode);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyName(VkfwInstance instance, VkfwKey key, int32_t scancode, const char** pKeyName);
+/* the names of many keys at once, NULL for keys without one and for VKFW_KEY_UNKNOWN. like vkfwGetKeyScancode and vkfwGetKeyName they come from
+   tables that are only rebuilt after a window gained focus: GLFW has no keyboard layout change event, so a layout switch while a window keeps the
+   focus is not seen until a window gains it again */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetKeyNames(VkfwInstance instance, uint32_t keyCount, const VkfwKey* pKeys, const char** pKeyNames);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwPostEmptyEvent(VkfwInstance instance);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwProcessEvents(VkfwInstance instance, double timeout, VkfwBool32 waitIndefinitely);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwWaitEventsUntil(VkfwInstance instance, uint64_t deadline); /* deadline in timer ticks, see vkfwGetTimerValue; UINT64_MAX waits indefinitely */
+/* processes the pending events without waiting, and leaves the work VKFW does besides the platform events for later once maxTicks have passed.
+   pEventsRemaining, if not NULL, is set to VKFW_TRUE if such work was left, so that another call before presenting would still generate events. */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwProcessEventsBudgeted(VkfwInstance instance, uint64_t maxTicks, VkfwBool32* pEventsRemaining);
+/* key names, the clipboard string, monitor and joystick names and dropped paths are copied into scratch memory of the instance, and stay valid
+   until the next event processing or vkfwResetScratch, which release them all at once */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwResetScratch(VkfwInstance instance);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetClipboardString(VkfwInstance instance, const char** pClipboardString);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetClipboardString(VkfwInstance instance, const char* clipboardString);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetTimerValue(VkfwInstance instance, uint64_t* pTimerValue);
+/* reads the timestamp source without validating anything, for profiling; 0 without an instance. the timer source counts in timer ticks.
+   timestamps are only comparable while the source stays the same: the CPU counter and the timer have different origins and frequencies. */
+VKFWAPI_ATTR uint64_t     VKFWAPI_CALL vkfwGetTimestamp(void);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetTimestampSource(VkfwInstance instance, VkfwTimestampSource source); /* not while other threads read timestamps, and not for an instance created with VKFW_INSTANCE_CREATE_ENABLE_TRACE_BIT */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetTimestampFrequency(VkfwInstance instance, uint64_t* pFrequency);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwResetFrameClock(VkfwInstance instance, VkfwFrameClock* pFrameClock);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwTickFrameClock(VkfwFrameClock* pFrameClock);
+/* the delta in seconds below which the given percentage (0 to 100) of the frames in the history are */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetFrameClockPercentile(const VkfwFrameClock* pFrameClock, float percentile, double* pDelta);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetInstanceStatistics(VkfwInstance instance, VkfwStatistics* pStatistics); /* can be called from any thread */
+/* writes the trace events recorded since the last flush to path as chrome trace event JSON, replacing the file; from one thread at a time */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwFlushTrace(VkfwInstance instance, const char* path);
+/* the allocations of GLFW are attributed to the subsystem of the entry point making them, like vkfwCreateWindow or vkfwGetClipboardString */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetAllocationStatistics(VkfwInstance instance, VkfwAllocationStatistics* pStatistics); /* can be called from any thread */
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitors(VkfwInstance instance, uint32_t* pMonitorCount, VkfwMonitor* pMonitors);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateMonitorProperties(VkfwMonitor monitor, VkfwMonitorProperties* pProperties);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetMonitorUserPointer(VkfwMonitor monitor, void* pUserPointer);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetMonitorGammaRamp(VkfwMonitor monitor, const VkfwGammaRamp* pGammaRamp);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetGammeRampFromGammaValue(VkfwMonitor monitor, float gamma, VkfwGammaRamp* pGammaRamp);
+/* the memory of VKFW for a window or cursor comes from pAllocator, or the allocator of the instance if it is NULL, and it has to be destroyed with
+   a compatible one; GLFW allocates from the allocator of the instance. shared standard cursors always use the allocator of the instance. */
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateWindow(VkfwMonitor monitor, const VkfwWindowCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwWindow* pWindow);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyWindow(VkfwWindow window, const VkfwAllocationCallbacks* pAllocator);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateWindowProperties(VkfwWindow window, VkfwWindowProperties* pProperties);
@@ -710,12 +930,41 @@ VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowSizeLimits(VkfwWindow window
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateCursor(VkfwInstance instance, const VkfwCursorCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwCursor* pCursor);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyCursor(VkfwCursor cursor, const VkfwAllocationCallbacks* pAllocator);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowCursor(VkfwWindow window, VkfwCursor cursor);
+/* the bindings are compiled into a table indexed by input and held modifiers, so that dispatching an input costs the same for any number of bindings */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwCreateActionMap(VkfwInstance instance, const VkfwActionMapCreateInfo* pCreateInfo, const VkfwAllocationCallbacks* pAllocator, VkfwActionMap* pActionMap);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwDestroyActionMap(VkfwActionMap actionMap, const VkfwAllocationCallbacks* pAllocator);
+/* recompiles the table; the held actions are released first, with their events */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetActionMapBindings(VkfwActionMap actionMap, uint32_t bindingCount, const VkfwActionBinding* pBindings);
+/* bit (action % 64) of pStateBits[action / 64] is set while the action is held; pStateBits needs room for all actions of the map */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetActionMapState(VkfwActionMap actionMap, uint64_t* pStateBits);
+/* the key and mouse button input of the window is fed to actionMap, NULL to stop; the map it replaces releases its held actions */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowActionMap(VkfwWindow window, VkfwActionMap actionMap);
+/* the events of disabled types are dropped before they reach VKFW, which skips its own work for them as well (see VkfwEventTypeFlagBits);
+   disabling the key or mouse button input releases the held actions of the action map of the window */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowDisabledEventTypes(VkfwWindow window, VkfwEventTypeFlags disabledEventTypes);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwUpdateGamepadMappings(VkfwInstance instance, uint32_t mappingCount, const VkfwGamepadMapping* mappings);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoysticks(VkfwInstance instance, uint32_t* pJoystickCount, VkfwJoystick* pJoysticks);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwEnumerateJoystickProperties(VkfwJoystick joystick, VkfwJoystickProperties* pProperties);
 VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetJoystickUserPointer(VkfwJoystick joystick, void* pUserPointer);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetJoystickSamplingRate(VkfwInstance instance, uint32_t samplesPerSecond);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSampleJoysticks(VkfwInstance instance);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwReadJoystickSamples(VkfwJoystick joystick, uint32_t* pSampleCount, VkfwJoystickSample* pSamples);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwSetWindowIconFromImage(VkfwWindow window, const VkfwImageData* pSourceImage);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetWindowFramebufferExtent(VkfwWindow window, VkfwExtent2D* pExtent, uint64_t* pGeneration); /* can be called from any thread while the window exists */
+/* the next frame deadline at the refresh rate of the monitor of the window, for vkfwWaitEventsUntil; pass 0 as the previous deadline for the first frame.
+   passing back the last returned deadline continues from the same origin, so the deadlines don't drift by the rounding of the frame period.
+   GLFW only reports integer rates; one below a multiple of 6 Hz, like 59 Hz, is taken as the NTSC style rate Windows rounds down, 59.94 Hz. */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwGetWindowNextFrameDeadline(VkfwWindow window, uint64_t previousDeadline, uint64_t* pDeadline);
 VKFWAPI_ATTR VkfwVkBool32 VKFWAPI_CALL vkfwVkGetPhysicalDevicePresentationSupport(VkfwVkInstance instance, VkfwVkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex);
 VKFWAPI_ATTR VkfwVkResult VKFWAPI_CALL vkfwVkCreateWindowSurface(VkfwVkInstance instance, VkfwWindow window, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurface);
+/* bit j of pSupportMasks[i] is set if queue family j of pPhysicalDevices[i] can present; at most 64 queue families per device */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwVkGetPhysicalDevicesPresentationSupport(VkfwVkInstance instance, uint32_t physicalDeviceCount, const VkfwVkPhysicalDevice* pPhysicalDevices, const uint32_t* pQueueFamilyCounts, uint64_t* pSupportMasks);
+/* resolves the surface and presentation support functions of a VkInstance once, for the vkfwVk functions to use; unload before destroying the VkInstance.
+   the presentation support of a loaded VkInstance is cached until it is unloaded, that of other VkInstances is queried every time. */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwLoadVulkanInstanceFunctions(VkfwInstance instance, VkfwVkInstance vulkanInstance);
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwUnloadVulkanInstanceFunctions(VkfwInstance instance, VkfwVkInstance vulkanInstance);
+/* pResults[i] is the result of creating pSurfaces[i], which is VK_NULL_HANDLE if it failed; all windows are validated before any surface is created */
+VKFWAPI_ATTR VkfwResult   VKFWAPI_CALL vkfwVkCreateWindowSurfaces(VkfwVkInstance instance, uint32_t windowCount, const VkfwWindow* pWindows, const VkfwVkAllocationCallbacks* pAllocator, VkfwVkSurfaceKHR* pSurfaces, VkfwVkResult* pResults);
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,659 @@
+/*************************************************************************
+ * VKFW 1.0 - C++20 header
+ * A library for window and input to use for Vulkan, based on GLFW 3.4
+ *------------------------------------------------------------------------
+ * Copyright (c) 2002-2006 Marcus Geelnard
+ * Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+ * Copyright (c) 2024-2025 Hypatia of Sva <hypatia.sva@posteo.eu>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would
+ *    be appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not
+ *    be misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source
+ *    distribution.
+ *
+ *************************************************************************/
+
+#ifndef _vkfw_hpp_
+#define _vkfw_hpp_
+
+#include "vkfw.h"
+
+#ifdef VKFW_NO_PROTOTYPES
+    #error "vkfw.hpp calls the VKFW functions directly and needs their prototypes"
+#endif
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/* header only and without exceptions: every function is an inline forward to the C function of the same name, so that the result and the out
+   parameters stay in registers and the calls compile to the same code as calling the C API. the handles of the unique types convert to the C
+   handles, so everything not wrapped here can be called on them directly. */
+namespace vkfw {
+
+/* the value of a VKFW call or its VkfwResult, in the interface of std::expected<T, VkfwResult>. the value is default constructed on errors. */
+template<class T>
+class [[nodiscard]] Expected {
+public:
+    constexpr Expected(VkfwResult result, T value) noexcept : m_value(std::move(value)), m_result(result) {}
+
+    [[nodiscard]] constexpr bool has_value() const noexcept { return m_result == VKFW_SUCCESS; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return m_result == VKFW_SUCCESS; }
+    [[nodiscard]] constexpr VkfwResult error() const noexcept { return m_result; }
+
+    [[nodiscard]] constexpr T& value() & noexcept { assert(has_value()); return m_value; }
+    [[nodiscard]] constexpr const T& value() const& noexcept { assert(has_value()); return m_value; }
+    [[nodiscard]] constexpr T&& value() && noexcept { assert(has_value()); return std::move(m_value); }
+    [[nodiscard]] constexpr T value_or(T defaultValue) && noexcept { return has_value() ? std::move(m_value) : std::move(defaultValue); }
+    [[nodiscard]] constexpr T value_or(T defaultValue) const& noexcept { return has_value() ? m_value : defaultValue; }
+
+    [[nodiscard]] constexpr T& operator*() & noexcept { return value(); }
+    [[nodiscard]] constexpr const T& operator*() const& noexcept { return value(); }
+    [[nodiscard]] constexpr T&& operator*() && noexcept { return std::move(*this).value(); }
+    [[nodiscard]] constexpr T* operator->() noexcept { return &value(); }
+    [[nodiscard]] constexpr const T* operator->() const noexcept { return &value(); }
+
+private:
+    T           m_value;
+    VkfwResult  m_result;
+};
+
+template<>
+class [[nodiscard]] Expected<void> {
+public:
+    constexpr Expected(VkfwResult result) noexcept : m_result(result) {}
+
+    [[nodiscard]] constexpr bool has_value() const noexcept { return m_result == VKFW_SUCCESS; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return m_result == VKFW_SUCCESS; }
+    [[nodiscard]] constexpr VkfwResult error() const noexcept { return m_result; }
+    constexpr void value() const noexcept { assert(has_value()); }
+
+private:
+    VkfwResult  m_result;
+};
+
+/* owns a handle and destroys it with the allocator it was created with. destroy windows, cursors and action maps before their instance. */
+template<class Handle, VkfwResult (VKFWAPI_PTR *Destroy)(Handle, const VkfwAllocationCallbacks*)>
+class UniqueHandle {
+public:
+    UniqueHandle() noexcept = default;
+    explicit UniqueHandle(Handle handle, const VkfwAllocationCallbacks* pAllocator = nullptr) noexcept : m_handle(handle), m_pAllocator(pAllocator) {}
+    UniqueHandle(const UniqueHandle&) = delete;
+    UniqueHandle& operator=(const UniqueHandle&) = delete;
+    UniqueHandle(UniqueHandle&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)), m_pAllocator(other.m_pAllocator) {}
+    UniqueHandle& operator=(UniqueHandle&& other) noexcept {
+        if(this != &other) {
+            reset();
+            m_handle = std::exchange(other.m_handle, nullptr);
+            m_pAllocator = other.m_pAllocator;
+        }
+        return *this;
+    }
+    ~UniqueHandle() { reset(); }
+
+    [[nodiscard]] Handle get() const noexcept { return m_handle; }
+    [[nodiscard]] const VkfwAllocationCallbacks* getAllocator() const noexcept { return m_pAllocator; }
+    /* only from lvalues, so that a handle can't be taken from a temporary that destroys it right away */
+    operator Handle() const& noexcept { return m_handle; }
+    operator Handle() const&& = delete;
+    [[nodiscard]] explicit operator bool() const noexcept { return m_handle != nullptr; }
+
+    /* gives up the ownership, the caller destroys the handle with getAllocator() */
+    [[nodiscard]] Handle release() noexcept { return std::exchange(m_handle, nullptr); }
+    void reset() noexcept {
+        if(m_handle != nullptr) (void) Destroy(std::exchange(m_handle, nullptr), m_pAllocator);
+    }
+
+private:
+    Handle                          m_handle = nullptr;
+    const VkfwAllocationCallbacks*  m_pAllocator = nullptr;
+};
+
+using UniqueInstance  = UniqueHandle<VkfwInstance, vkfwDestroyInstance>;
+using UniqueWindow    = UniqueHandle<VkfwWindow, vkfwDestroyWindow>;
+using UniqueCursor    = UniqueHandle<VkfwCursor, vkfwDestroyCursor>;
+using UniqueActionMap = UniqueHandle<VkfwActionMap, vkfwDestroyActionMap>;
+
+namespace detail {
+    template<auto Member, class MemberType = decltype(Member)>
+    struct MemberCallback;
+
+    /* the callback types end with void* pUserData, which is the object. the parameter pack is not deduced here, so it can come first. */
+    template<auto Member, class Class, class... Args>
+    struct MemberCallback<Member, void (Class::*)(Args...)> {
+        static void VKFWAPI_CALL call(Args... args, void* pUserData) { (static_cast<Class*>(pUserData)->*Member)(args...); }
+    };
+    template<auto Member, class Class, class... Args>
+    struct MemberCallback<Member, void (Class::*)(Args...) noexcept> {
+        static void VKFWAPI_CALL call(Args... args, void* pUserData) noexcept { (static_cast<Class*>(pUserData)->*Member)(args...); }
+    };
+    template<auto Member, class Class, class... Args>
+    struct MemberCallback<Member, void (Class::*)(Args...) const> {
+        static void VKFWAPI_CALL call(Args... args, void* pUserData) { (static_cast<const Class*>(pUserData)->*Member)(args...); }
+    };
+    template<auto Member, class Class, class... Args>
+    struct MemberCallback<Member, void (Class::*)(Args...) const noexcept> {
+        static void VKFWAPI_CALL call(Args... args, void* pUserData) noexcept { (static_cast<const Class*>(pUserData)->*Member)(args...); }
+    };
+}
+
+/* a plain function pointer for a VKFW callback that calls Member on the object in pUserData of the callbacks struct, with the other arguments
+   of the callback; a member with the wrong parameters doesn't convert to the callback type. for example:
+
+       callbacks.pUserData = &game;
+       callbacks.keyInput = vkfw::memberCallback<&Game::onKey>; // void Game::onKey(VkfwWindow, VkfwKey, int32_t, VkfwKeyAction, VkfwModifierKeyMask)
+*/
+template<auto Member>
+inline constexpr auto memberCallback = &detail::MemberCallback<Member>::call;
+
+
+[[nodiscard]] inline Expected<VkfwGlobalProperties> enumerateGlobalProperties() noexcept {
+    VkfwGlobalProperties properties = {};
+    VkfwResult result = vkfwEnumerateGlobalProperties(&properties);
+    return {result, properties};
+}
+[[nodiscard]] inline Expected<UniqueInstance> createInstance(const VkfwInstanceCreateInfo& createInfo, const VkfwAllocationCallbacks* pAllocator = nullptr) noexcept {
+    VkfwInstance instance = nullptr;
+    VkfwResult result = vkfwCreateInstance(&createInfo, pAllocator, &instance);
+    return {result, UniqueInstance(result == VKFW_SUCCESS ? instance : nullptr, pAllocator)};
+}
+[[nodiscard]] inline Expected<VkfwInstanceProperties> enumerateInstanceProperties(VkfwInstance instance) noexcept {
+    VkfwInstanceProperties properties = {};
+    VkfwResult result = vkfwEnumerateInstanceProperties(instance, &properties);
+    return {result, properties};
+}
+[[nodiscard]] inline Expected<int32_t> getKeyScancode(VkfwInstance instance, VkfwKey key) noexcept {
+    int32_t scancode = 0;
+    VkfwResult result = vkfwGetKeyScancode(instance, key, &scancode);
+    return {result, scancode};
+}
+[[nodiscard]] inline Expected<const char*> getKeyName(VkfwInstance instance, VkfwKey key, int32_t scancode = 0) noexcept {
+    const char* keyName = nullptr;
+    VkfwResult result = vkfwGetKeyName(instance, key, scancode, &keyName);
+    return {result, keyName};
+}
+/* keyNames needs at least as many elements as keys */
+[[nodiscard]] inline Expected<void> getKeyNames(VkfwInstance instance, std::span<const VkfwKey> keys, std::span<const char*> keyNames) noexcept {
+    if(keyNames.size() < keys.size()) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    return vkfwGetKeyNames(instance, static_cast<uint32_t>(keys.size()), keys.data(), keyNames.data());
+}
+[[nodiscard]] inline Expected<void> postEmptyEvent(VkfwInstance instance) noexcept {
+    return vkfwPostEmptyEvent(instance);
+}
+[[nodiscard]] inline Expected<void> processEvents(VkfwInstance instance, double timeout = 0.0, bool waitIndefinitely = false) noexcept {
+    return vkfwProcessEvents(instance, timeout, waitIndefinitely ? VKFW_TRUE : VKFW_FALSE);
+}
+[[nodiscard]] inline Expected<void> waitEventsUntil(VkfwInstance instance, uint64_t deadline) noexcept {
+    return vkfwWaitEventsUntil(instance, deadline);
+}
+/* the value is whether work was left for a later call, see vkfwProcessEventsBudgeted */
+[[nodiscard]] inline Expected<bool> processEventsBudgeted(VkfwInstance instance, uint64_t maxTicks) noexcept {
+    VkfwBool32 eventsRemaining = VKFW_FALSE;
+    VkfwResult result = vkfwProcessEventsBudgeted(instance, maxTicks, &eventsRemaining);
+    return {result, eventsRemaining != VKFW_FALSE};
+}
+[[nodiscard]] inline Expected<void> resetScratch(VkfwInstance instance) noexcept {
+    return vkfwResetScratch(instance);
+}
+[[nodiscard]] inline Expected<const char*> getClipboardString(VkfwInstance instance) noexcept {
+    const char* clipboardString = nullptr;
+    VkfwResult result = vkfwGetClipboardString(instance, &clipboardString);
+    return {result, clipboardString};
+}
+[[nodiscard]] inline Expected<void> setClipboardString(VkfwInstance instance, const char* clipboardString) noexcept {
+    return vkfwSetClipboardString(instance, clipboardString);
+}
+[[nodiscard]] inline Expected<uint64_t> getTimerValue(VkfwInstance instance) noexcept {
+    uint64_t timerValue = 0;
+    VkfwResult result = vkfwGetTimerValue(instance, &timerValue);
+    return {result, timerValue};
+}
+[[nodiscard]] inline uint64_t getTimestamp() noexcept {
+    return vkfwGetTimestamp();
+}
+[[nodiscard]] inline Expected<uint64_t> getTimestampFrequency(VkfwInstance instance) noexcept {
+    uint64_t frequency = 0;
+    VkfwResult result = vkfwGetTimestampFrequency(instance, &frequency);
+    return {result, frequency};
+}
+[[nodiscard]] inline Expected<void> resetFrameClock(VkfwInstance instance, VkfwFrameClock& frameClock) noexcept {
+    return vkfwResetFrameClock(instance, &frameClock);
+}
+[[nodiscard]] inline Expected<void> tickFrameClock(VkfwFrameClock& frameClock) noexcept {
+    return vkfwTickFrameClock(&frameClock);
+}
+
+/* the number of monitors, for the size of the span of the overload below */
+[[nodiscard]] inline Expected<uint32_t> enumerateMonitors(VkfwInstance instance) noexcept {
+    uint32_t monitorCount = 0;
+    VkfwResult result = vkfwEnumerateMonitors(instance, &monitorCount, nullptr);
+    return {result, monitorCount};
+}
+/* the value is the part of monitors that was written. vkfwEnumerateMonitors writes all monitors, so a span with room for fewer is an error. */
+[[nodiscard]] inline Expected<std::span<VkfwMonitor>> enumerateMonitors(VkfwInstance instance, std::span<VkfwMonitor> monitors) noexcept {
+    uint32_t monitorCount = 0;
+    VkfwResult result = vkfwEnumerateMonitors(instance, &monitorCount, nullptr);
+    if(result != VKFW_SUCCESS) return {result, {}};
+    if(monitorCount > monitors.size()) return {VKFW_ERROR_INVALID_NUMERIC_VALUE, {}};
+    result = vkfwEnumerateMonitors(instance, &monitorCount, monitors.data());
+    return {result, monitors.first(result == VKFW_SUCCESS ? monitorCount : 0)};
+}
+[[nodiscard]] inline Expected<VkfwMonitorProperties> enumerateMonitorProperties(VkfwMonitor monitor) noexcept {
+    VkfwMonitorProperties properties = {};
+    VkfwResult result = vkfwEnumerateMonitorProperties(monitor, &properties);
+    return {result, properties};
+}
+
+[[nodiscard]] inline Expected<UniqueWindow> createWindow(VkfwMonitor monitor, const VkfwWindowCreateInfo& createInfo, const VkfwAllocationCallbacks* pAllocator = nullptr) noexcept {
+    VkfwWindow window = nullptr;
+    VkfwResult result = vkfwCreateWindow(monitor, &createInfo, pAllocator, &window);
+    return {result, UniqueWindow(result == VKFW_SUCCESS ? window : nullptr, pAllocator)};
+}
+[[nodiscard]] inline Expected<VkfwWindowProperties> enumerateWindowProperties(VkfwWindow window) noexcept {
+    VkfwWindowProperties properties = {};
+    VkfwResult result = vkfwEnumerateWindowProperties(window, &properties);
+    return {result, properties};
+}
+[[nodiscard]] inline Expected<void> setWindowState(VkfwWindow window, const VkfwWindowState& newState) noexcept {
+    return vkfwSetWindowState(window, newState);
+}
+[[nodiscard]] inline Expected<void> setWindowIcon(VkfwWindow window, std::span<const VkfwImageData> images) noexcept {
+    return vkfwSetWindowIcon(window, static_cast<uint32_t>(images.size()), images.data());
+}
+/* can be called from any thread while the window exists */
+[[nodiscard]] inline Expected<VkfwExtent2D> getWindowFramebufferExtent(VkfwWindow window, uint64_t* pGeneration = nullptr) noexcept {
+    VkfwExtent2D extent = {};
+    VkfwResult result = vkfwGetWindowFramebufferExtent(window, &extent, pGeneration);
+    return {result, extent};
+}
+[[nodiscard]] inline Expected<uint64_t> getWindowNextFrameDeadline(VkfwWindow window, uint64_t previousDeadline = 0) noexcept {
+    uint64_t deadline = 0;
+    VkfwResult result = vkfwGetWindowNextFrameDeadline(window, previousDeadline, &deadline);
+    return {result, deadline};
+}
+[[nodiscard]] inline Expected<void> setWindowDisabledEventTypes(VkfwWindow window, VkfwEventTypeFlags disabledEventTypes) noexcept {
+    return vkfwSetWindowDisabledEventTypes(window, disabledEventTypes);
+}
+
+[[nodiscard]] inline Expected<UniqueCursor> createCursor(VkfwInstance instance, const VkfwCursorCreateInfo& createInfo, const VkfwAllocationCallbacks* pAllocator = nullptr) noexcept {
+    VkfwCursor cursor = nullptr;
+    VkfwResult result = vkfwCreateCursor(instance, &createInfo, pAllocator, &cursor);
+    return {result, UniqueCursor(result == VKFW_SUCCESS ? cursor : nullptr, pAllocator)};
+}
+[[nodiscard]] inline Expected<void> setWindowCursor(VkfwWindow window, VkfwCursor cursor) noexcept {
+    return vkfwSetWindowCursor(window, cursor);
+}
+
+[[nodiscard]] inline Expected<UniqueActionMap> createActionMap(VkfwInstance instance, const VkfwActionMapCreateInfo& createInfo, const VkfwAllocationCallbacks* pAllocator = nullptr) noexcept {
+    VkfwActionMap actionMap = nullptr;
+    VkfwResult result = vkfwCreateActionMap(instance, &createInfo, pAllocator, &actionMap);
+    return {result, UniqueActionMap(result == VKFW_SUCCESS ? actionMap : nullptr, pAllocator)};
+}
+[[nodiscard]] inline Expected<void> setActionMapBindings(VkfwActionMap actionMap, std::span<const VkfwActionBinding> bindings) noexcept {
+    return vkfwSetActionMapBindings(actionMap, static_cast<uint32_t>(bindings.size()), bindings.data());
+}
+/* stateBits needs room for all actions of the map, see vkfwGetActionMapState */
+[[nodiscard]] inline Expected<void> getActionMapState(VkfwActionMap actionMap, std::span<uint64_t> stateBits) noexcept {
+    return vkfwGetActionMapState(actionMap, stateBits.data());
+}
+[[nodiscard]] inline Expected<void> setWindowActionMap(VkfwWindow window, VkfwActionMap actionMap) noexcept {
+    return vkfwSetWindowActionMap(window, actionMap);
+}
+
+/* the number of joysticks, for the size of the span of the overload below */
+[[nodiscard]] inline Expected<uint32_t> enumerateJoysticks(VkfwInstance instance) noexcept {
+    uint32_t joystickCount = 0;
+    VkfwResult result = vkfwEnumerateJoysticks(instance, &joystickCount, nullptr);
+    return {result, joystickCount};
+}
+/* the value is the part of joysticks that was written. vkfwEnumerateJoysticks writes all joysticks, so a span with room for fewer is an error. */
+[[nodiscard]] inline Expected<std::span<VkfwJoystick>> enumerateJoysticks(VkfwInstance instance, std::span<VkfwJoystick> joysticks) noexcept {
+    uint32_t joystickCount = 0;
+    VkfwResult result = vkfwEnumerateJoysticks(instance, &joystickCount, nullptr);
+    if(result != VKFW_SUCCESS) return {result, {}};
+    if(joystickCount > joysticks.size()) return {VKFW_ERROR_INVALID_NUMERIC_VALUE, {}};
+    result = vkfwEnumerateJoysticks(instance, &joystickCount, joysticks.data());
+    return {result, joysticks.first(result == VKFW_SUCCESS ? joystickCount : 0)};
+}
+[[nodiscard]] inline Expected<VkfwJoystickProperties> enumerateJoystickProperties(VkfwJoystick joystick) noexcept {
+    VkfwJoystickProperties properties = {};
+    VkfwResult result = vkfwEnumerateJoystickProperties(joystick, &properties);
+    return {result, properties};
+}
+/* the value is the part of samples that was written, the oldest samples first; the rest stay queued for the next read */
+[[nodiscard]] inline Expected<std::span<VkfwJoystickSample>> readJoystickSamples(VkfwJoystick joystick, std::span<VkfwJoystickSample> samples) noexcept {
+    uint32_t sampleCount = static_cast<uint32_t>(samples.size());
+    VkfwResult result = vkfwReadJoystickSamples(joystick, &sampleCount, samples.data());
+    return {result, samples.first(result == VKFW_SUCCESS ? sampleCount : 0)};
+}
+
+/* surfaces and results need at least as many elements as windows */
+[[nodiscard]] inline Expected<void> vkCreateWindowSurfaces(VkfwVkInstance instance, std::span<const VkfwWindow> windows, const VkfwVkAllocationCallbacks* pAllocator,
+                                                           std::span<VkfwVkSurfaceKHR> surfaces, std::span<VkfwVkResult> results) noexcept {
+    if(surfaces.size() < windows.size() || results.size() < windows.size()) return VKFW_ERROR_INVALID_NUMERIC_VALUE;
+    return vkfwVkCreateWindowSurfaces(instance, static_cast<uint32_t>(windows.size()), windows.data(), pAllocator, surfaces.data(), results.data());
+}
+
+
+/* coroutines waiting for events of windows or for timer deadlines. the awaiters live in the coroutine frames and are linked into the list of
+   what they wait for, so awaiting allocates nothing; only the frame of a Task is allocated, once. all of it is for the thread processing the
+   events. window events resume their tasks from within the event processing, right after the callback the window had for the event:
+
+       vkfw::Task resizeLoop(vkfw::WindowEvents& events) {
+           for(;;) {
+               vkfw::FramebufferExtent resized = co_await vkfw::framebufferResized(events);
+               recreateSwapchain(resized.extent);
+           }
+       }
+*/
+namespace detail {
+    struct WaitList;
+
+    struct WaitNode {
+        WaitNode() noexcept = default;
+        WaitNode(const WaitNode&) = delete;
+        WaitNode& operator=(const WaitNode&) = delete;
+        inline ~WaitNode();
+
+        WaitList*               list = nullptr;
+        WaitNode*               previous = nullptr;
+        WaitNode*               next = nullptr;
+        std::coroutine_handle<> handle;
+        const void*             pValue = nullptr; /* the event, only valid until await_resume */
+    };
+
+    struct WaitList {
+        WaitList() noexcept = default;
+        WaitList(const WaitList&) = delete;
+        WaitList& operator=(const WaitList&) = delete;
+        /* the nodes still waiting are never resumed */
+        ~WaitList() {
+            for(WaitNode* node = first; node != nullptr; node = node->next) node->list = nullptr;
+        }
+
+        void insertBefore(WaitNode* position, WaitNode* node) noexcept {
+            node->list = this;
+            node->next = position;
+            node->previous = (position != nullptr) ? position->previous : last;
+            if(node->previous != nullptr) node->previous->next = node; else first = node;
+            if(position != nullptr) position->previous = node; else last = node;
+        }
+        void pushBack(WaitNode* node) noexcept { insertBefore(nullptr, node); }
+        void remove(WaitNode* node) noexcept {
+            if(node->previous != nullptr) node->previous->next = node->next; else first = node->next;
+            if(node->next != nullptr) node->next->previous = node->previous; else last = node->previous;
+            node->list = nullptr;
+            node->previous = nullptr;
+            node->next = nullptr;
+        }
+        /* resumes the nodes in order. each is unlinked first, so a task can wait again, and a task destroyed by another one leaves the list. */
+        void resumeAll(const void* pValue) noexcept {
+            while(first != nullptr) {
+                WaitNode* node = first;
+                remove(node);
+                node->pValue = pValue;
+                node->handle.resume();
+            }
+        }
+        /* moves all nodes to list, so that the ones waiting from now on wait for the next event */
+        void moveTo(WaitList& list) noexcept {
+            while(first != nullptr) {
+                WaitNode* node = first;
+                remove(node);
+                list.pushBack(node);
+            }
+        }
+
+        WaitNode*   first = nullptr;
+        WaitNode*   last = nullptr;
+    };
+
+    /* a task destroyed while waiting, together with the awaiter in its frame, leaves the list */
+    inline WaitNode::~WaitNode() {
+        if(list != nullptr) list->remove(this);
+    }
+
+    template<class Value>
+    class EventAwaiter : WaitNode {
+    public:
+        explicit EventAwaiter(WaitList& list) noexcept : m_list(list) {}
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> awaitingHandle) noexcept {
+            handle = awaitingHandle;
+            m_list.pushBack(this);
+        }
+        Value await_resume() const noexcept {
+            if constexpr(!std::is_void_v<Value>) return *static_cast<const Value*>(pValue);
+        }
+
+    private:
+        WaitList&   m_list;
+    };
+}
+
+/* a coroutine that starts right away and runs until its first co_await. destroying the Task destroys a coroutine that hasn't finished, which
+   stops its waiting. exceptions leaving the coroutine terminate, since VKFW resumes it from C callbacks. */
+class [[nodiscard]] Task {
+public:
+    struct promise_type {
+        Task get_return_object() noexcept { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+
+    Task() noexcept = default;
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if(this != &other) {
+            if(m_handle) m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+    ~Task() { if(m_handle) m_handle.destroy(); }
+
+    [[nodiscard]] bool done() const noexcept { return !m_handle || m_handle.done(); }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+struct KeyEvent {
+    VkfwWindow              window;
+    VkfwKey                 key;
+    int32_t                 scancode;
+    VkfwKeyAction           action;
+    VkfwModifierKeyMask     mods;
+};
+struct FramebufferExtent {
+    VkfwWindow      window;
+    VkfwExtent2D    extent;
+    uint64_t        generation;
+};
+
+/* the events of one window for the awaitables. hook it into the callbacks of the create info before creating the window; it calls the
+   callbacks that were there with their pUserData, so it has to outlive the window and can't be moved. */
+class WindowEvents {
+public:
+    WindowEvents() noexcept = default;
+    WindowEvents(const WindowEvents&) = delete;
+    WindowEvents& operator=(const WindowEvents&) = delete;
+
+    void hook(VkfwWindowCallbacks& callbacks) noexcept {
+        m_next = callbacks;
+        callbacks.pUserData = this;
+        forward<&VkfwWindowCallbacks::positionChange, &VkfwWindowCallbacks::sizeChange, &VkfwWindowCallbacks::framebufferSizeChange,
+                &VkfwWindowCallbacks::contentScaleChange, &VkfwWindowCallbacks::cursorPositionChange, &VkfwWindowCallbacks::focusChange,
+                &VkfwWindowCallbacks::iconficationChange, &VkfwWindowCallbacks::maximizationChange, &VkfwWindowCallbacks::contentAreaNeedsToBeRedrawn,
+                &VkfwWindowCallbacks::pathDrop, &VkfwWindowCallbacks::mouseButtonInput, &VkfwWindowCallbacks::scrollInput,
+                &VkfwWindowCallbacks::cursorEnterOrLeaveContentArea, &VkfwWindowCallbacks::unicodeCharacterInput,
+                &VkfwWindowCallbacks::unicodeCharacterInputWithModifiers, &VkfwWindowCallbacks::textInput>(callbacks);
+        callbacks.keyInput = memberCallback<&WindowEvents::onKeyInput>;
+        callbacks.framebufferExtentSettled = memberCallback<&WindowEvents::onFramebufferExtentSettled>;
+        callbacks.closeButtonClicked = memberCallback<&WindowEvents::onCloseButtonClicked>;
+    }
+
+private:
+    friend detail::EventAwaiter<KeyEvent> nextKey(WindowEvents& events) noexcept;
+    friend detail::EventAwaiter<FramebufferExtent> framebufferResized(WindowEvents& events) noexcept;
+    friend detail::EventAwaiter<void> closeRequested(WindowEvents& events) noexcept;
+
+    /* the callbacks that aren't awaitable keep their own type; only the ones set get a forwarding trampoline */
+    template<auto... Fields>
+    void forward(VkfwWindowCallbacks& callbacks) noexcept {
+        ((callbacks.*Fields = (m_next.*Fields != nullptr) ? forwarder<Fields>(Fields) : nullptr), ...);
+    }
+    template<auto Field, class... Params>
+    static auto forwarder(void (* VkfwWindowCallbacks::*)(Params...)) noexcept {
+        return &forwardCall<Field, Params...>;
+    }
+    /* the last parameter is pUserData, which is replaced by the one of the hooked callbacks */
+    template<auto Field, class... Params>
+    static void VKFWAPI_CALL forwardCall(Params... params) {
+        auto arguments = std::forward_as_tuple(params...);
+        const VkfwWindowCallbacks& next = static_cast<const WindowEvents*>(std::get<sizeof...(Params) - 1>(arguments))->m_next;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (next.*Field)(std::get<I>(arguments)..., next.pUserData);
+        }(std::make_index_sequence<sizeof...(Params) - 1>());
+    }
+
+    void onKeyInput(VkfwWindow window, VkfwKey key, int32_t scancode, VkfwKeyAction action, VkfwModifierKeyMask mods) noexcept {
+        if(m_next.keyInput != nullptr) m_next.keyInput(window, key, scancode, action, mods, m_next.pUserData);
+        KeyEvent event = {window, key, scancode, action, mods};
+        resume(m_keyWaiters, &event);
+    }
+    void onFramebufferExtentSettled(VkfwWindow window, VkfwExtent2D extent, uint64_t generation) noexcept {
+        if(m_next.framebufferExtentSettled != nullptr) m_next.framebufferExtentSettled(window, extent, generation, m_next.pUserData);
+        FramebufferExtent event = {window, extent, generation};
+        resume(m_framebufferWaiters, &event);
+    }
+    void onCloseButtonClicked(VkfwWindow window) noexcept {
+        if(m_next.closeButtonClicked != nullptr) m_next.closeButtonClicked(window, m_next.pUserData);
+        resume(m_closeWaiters, nullptr);
+    }
+    /* the tasks waiting from now on, also the resumed ones, wait for the next event; a resumed task may destroy this object */
+    static void resume(detail::WaitList& waiters, const void* pValue) noexcept {
+        detail::WaitList resuming;
+        waiters.moveTo(resuming);
+        resuming.resumeAll(pValue);
+    }
+
+    VkfwWindowCallbacks m_next = {};
+    detail::WaitList    m_keyWaiters;
+    detail::WaitList    m_framebufferWaiters;
+    detail::WaitList    m_closeWaiters;
+};
+
+/* resumes with the next key event of the window, of any action */
+[[nodiscard]] inline detail::EventAwaiter<KeyEvent> nextKey(WindowEvents& events) noexcept {
+    return detail::EventAwaiter<KeyEvent>(events.m_keyWaiters);
+}
+/* resumes once the framebuffer extent settled after a resize, see framebufferSettlePeriod */
+[[nodiscard]] inline detail::EventAwaiter<FramebufferExtent> framebufferResized(WindowEvents& events) noexcept {
+    return detail::EventAwaiter<FramebufferExtent>(events.m_framebufferWaiters);
+}
+/* resumes when the close button of the window is clicked */
+[[nodiscard]] inline detail::EventAwaiter<void> closeRequested(WindowEvents& events) noexcept {
+    return detail::EventAwaiter<void>(events.m_closeWaiters);
+}
+
+/* tasks waiting for deadlines in timer ticks, see vkfwGetTimerValue. GLFW has no timer events, so they are resumed by waitEventsUntil below
+   after the events, or by resumeExpired. the waiters are kept sorted; deadlines are usually later than the waiting ones, so the search for
+   the place of a new one starts at the end. */
+class Timers {
+public:
+    Timers() noexcept = default;
+    Timers(const Timers&) = delete;
+    Timers& operator=(const Timers&) = delete;
+
+    /* UINT64_MAX without waiting tasks */
+    [[nodiscard]] uint64_t nextDeadline() const noexcept;
+    /* resumes the tasks whose deadline is at most now, the earliest first; tasks waiting from within these resume on the next call at earliest */
+    void resumeExpired(uint64_t now) noexcept {
+        detail::WaitList expired;
+        while(m_waiters.first != nullptr && deadlineOf(m_waiters.first) <= now) {
+            detail::WaitNode* node = m_waiters.first;
+            m_waiters.remove(node);
+            expired.pushBack(node);
+        }
+        expired.resumeAll(nullptr);
+    }
+
+private:
+    class Awaiter : detail::WaitNode {
+    public:
+        Awaiter(Timers& timers, uint64_t deadline) noexcept : m_timers(timers), m_deadline(deadline) {}
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> awaitingHandle) noexcept {
+            handle = awaitingHandle;
+            detail::WaitNode* position = m_timers.m_waiters.last;
+            while(position != nullptr && deadlineOf(position) > m_deadline) position = position->previous;
+            m_timers.m_waiters.insertBefore((position != nullptr) ? position->next : m_timers.m_waiters.first, this);
+        }
+        void await_resume() const noexcept {}
+
+    private:
+        friend class Timers;
+
+        Timers&     m_timers;
+        uint64_t    m_deadline;
+    };
+
+    friend Awaiter until(Timers& timers, uint64_t deadline) noexcept;
+
+    static uint64_t deadlineOf(const detail::WaitNode* node) noexcept { return static_cast<const Awaiter*>(node)->m_deadline; }
+
+    detail::WaitList    m_waiters;
+};
+
+inline uint64_t Timers::nextDeadline() const noexcept {
+    return (m_waiters.first != nullptr) ? deadlineOf(m_waiters.first) : UINT64_MAX;
+}
+
+/* resumes once the timer value reached deadline */
+[[nodiscard]] inline Timers::Awaiter until(Timers& timers, uint64_t deadline) noexcept {
+    return Timers::Awaiter(timers, deadline);
+}
+/* waits for events until deadline or the next deadline of timers, whichever is earlier, and then resumes the expired timers */
+[[nodiscard]] inline Expected<void> waitEventsUntil(VkfwInstance instance, Timers& timers, uint64_t deadline = UINT64_MAX) noexcept {
+    uint64_t timerDeadline = timers.nextDeadline();
+    VkfwResult result = vkfwWaitEventsUntil(instance, (timerDeadline < deadline) ? timerDeadline : deadline);
+    if(result != VKFW_SUCCESS) return result;
+    uint64_t now = 0;
+    result = vkfwGetTimerValue(instance, &now);
+    if(result != VKFW_SUCCESS) return result;
+    timers.resumeExpired(now);
+    return VKFW_SUCCESS;
+}
+
+}
+
+#endif /* _vkfw_hpp_ */